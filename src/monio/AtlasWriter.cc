@@ -12,6 +12,8 @@
 #include "atlas/grid/Iterator.h"
 #include "oops/util/Logger.h"
 
+#include "AttributeDouble.h"
+#include "AttributeInt.h"
 #include "AttributeString.h"
 #include "DataContainerDouble.h"
 #include "DataContainerFloat.h"
@@ -20,6 +22,7 @@
 #include "Monio.h"
 #include "Utils.h"
 #include "UtilsAtlas.h"
+#include "UtilsPermute.h"
 #include "Writer.h"
 
 monio::AtlasWriter::AtlasWriter(const eckit::mpi::Comm& mpiCommunicator, const int mpiRankOwner):
@@ -36,17 +39,17 @@ void monio::AtlasWriter::populateFileDataWithField(FileData& fileData,
                                              const bool isLfricConvention) {
   oops::Log::trace() << "AtlasWriter::populateFileDataWithField()" << std::endl;
   if (mpiCommunicator_.rank() == mpiRankOwner_) {
-    std::vector<size_t>& lfricAtlasMap = fileData.getLfricAtlasMap();
+    std::vector<uint32_t>& lfricAtlasMap = fileData.getLfricAtlasMap();
     // Create dimensions
     Metadata& metadata = fileData.getMetadata();
-    atlas::Field writeField;
+    consts::LevelRemap levelRemap;
     if (isLfricConvention == true) {
-      writeField = getWriteField(field, writeName, fieldMetadata.noFirstLevel);
-    } else {
-      writeField = field;
+      levelRemap = getWriteLevelRemap(field, writeName, fieldMetadata.noFirstLevel);
     }
-    populateMetadataWithField(metadata, writeField, fieldMetadata, writeName, vertConfigName);
-    populateDataWithField(fileData.getData(), writeField, lfricAtlasMap, writeName);
+    populateMetadataWithField(metadata, field, fieldMetadata, writeName, vertConfigName,
+                              levelRemap);
+    populateDataWithField(fileData.getData(), field, lfricAtlasMap, writeName,
+                          getWriteType(field, fieldMetadata), levelRemap);
     addGlobalAttributes(metadata, isLfricConvention);
   }
 }
@@ -73,61 +76,126 @@ void monio::AtlasWriter::populateFileDataWithField(FileData& fileData,
     }
     // Create metadata
     populateMetadataWithField(metadata, field, writeName);
-    // Create lon and lat
-    std::vector<atlas::PointLonLat> atlasLonLat = utilsatlas::getAtlasCoords(field);
-    std::vector<std::shared_ptr<DataContainerBase>> coordContainers =
-              utilsatlas::convertLatLonToContainers(atlasLonLat, consts::kCoordVarNames);
-    for (const auto& coordContainer : coordContainers) {
-      data.addContainer(coordContainer);
+    // Create lon and lat, once per file. Metadata are retained between the fields of a file.
+    const std::string lonName = consts::kCoordVarNames[consts::eLongitude];
+    if (metadata.getVariablesMap().count(lonName) == 0) {
+      std::vector<atlas::PointLonLat> atlasLonLat = utilsatlas::getAtlasCoords(field);
+      std::vector<std::shared_ptr<DataContainerBase>> coordContainers =
+                utilsatlas::convertLatLonToContainers(atlasLonLat, consts::kCoordVarNames);
+      for (const auto& coordContainer : coordContainers) {
+        data.addContainer(coordContainer);
+      }
+      std::shared_ptr<monio::Variable> lonVar = std::make_shared<Variable>(
+                    consts::kCoordVarNames[consts::eLongitude], consts::eDouble);
+      std::shared_ptr<monio::Variable> latVar = std::make_shared<Variable>(
+                    consts::kCoordVarNames[consts::eLatitude], consts::eDouble);
+      std::string dimName = metadata.getDimensionName(atlasLonLat.size());
+      lonVar->addDimension(dimName, atlasLonLat.size());
+      latVar->addDimension(dimName, atlasLonLat.size());
+      metadata.addVariable(consts::kCoordVarNames[consts::eLongitude], lonVar);
+      metadata.addVariable(consts::kCoordVarNames[consts::eLatitude], latVar);
     }
-    std::shared_ptr<monio::Variable> lonVar = std::make_shared<Variable>(
-                  consts::kCoordVarNames[consts::eLongitude], consts::eDouble);
-    std::shared_ptr<monio::Variable> latVar = std::make_shared<Variable>(
-                  consts::kCoordVarNames[consts::eLatitude], consts::eDouble);
-    std::string dimName = metadata.getDimensionName(atlasLonLat.size());
-    lonVar->addDimension(dimName, atlasLonLat.size());
-    latVar->addDimension(dimName, atlasLonLat.size());
-    metadata.addVariable(consts::kCoordVarNames[consts::eLongitude], lonVar);
-    metadata.addVariable(consts::kCoordVarNames[consts::eLatitude], latVar);
 
     populateDataWithField(data, field, fieldShape);
     addGlobalAttributes(metadata, false);
   }
 }
 
+void monio::AtlasWriter::populateDataWithField(FileData& fileData,
+                                               atlas::Field& field,
+                                         const consts::FieldMetadata& fieldMetadata,
+                                         const std::string& writeName,
+                                         const bool isLfricConvention) {
+  oops::Log::trace() << "AtlasWriter::populateDataWithField()" << std::endl;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    consts::LevelRemap levelRemap;
+    if (isLfricConvention == true) {
+      levelRemap = getWriteLevelRemap(field, writeName, fieldMetadata.noFirstLevel);
+    }
+    populateDataWithField(fileData.getData(), field, fileData.getLfricAtlasMap(), writeName,
+                          getWriteType(field, fieldMetadata), levelRemap);
+  }
+}
+
+void monio::AtlasWriter::populateMetadataWithDistributedField(FileData& fileData,
+                                                        const atlas::Field& field,
+                                                        const consts::FieldMetadata& fieldMetadata,
+                                                        const std::string& writeName,
+                                                        const std::string& vertConfigName,
+                                                        const bool isLfricConvention) {
+  oops::Log::trace() << "AtlasWriter::populateMetadataWithDistributedField()" << std::endl;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    consts::LevelRemap levelRemap;
+    if (isLfricConvention == true) {
+      levelRemap = getWriteLevelRemap(field, writeName, fieldMetadata.noFirstLevel);
+    }
+    Metadata& metadata = fileData.getMetadata();
+    std::vector<atlas::idx_t> fieldShape = {
+        static_cast<atlas::idx_t>(fileData.getLfricAtlasMap().size()),
+        field.shape(consts::eVertical) + static_cast<atlas::idx_t>(levelRemap.levelOffset)};
+    int type = getWriteType(field, fieldMetadata);
+    std::shared_ptr<monio::Variable> var = std::make_shared<Variable>(writeName, type);
+    addVariableDimensions(fieldShape, metadata, var, vertConfigName);
+    addVariableAttributes(var, fieldMetadata);
+    metadata.addVariable(writeName, var);
+    addGlobalAttributes(metadata, isLfricConvention);
+  }
+}
+
+void monio::AtlasWriter::addPackingAttributes(FileData& fileData,
+                                        const std::string& writeName,
+                                        const int outputType,
+                                        const double minValue,
+                                        const double maxValue) {
+  oops::Log::trace() << "AtlasWriter::addPackingAttributes()" << std::endl;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    const bool isShort = outputType == consts::eShort;
+    double numIntervals = 2.0 * (isShort == true ? consts::kPackedShortMax :
+                                                   consts::kPackedByteMax);
+    double scaleFactor = 1.0;
+    double addOffset = 0.0;  // Where all values are NaN, and so are written as fill values
+    if (maxValue > minValue) {
+      scaleFactor = (maxValue - minValue) / numIntervals;
+    }
+    if (maxValue >= minValue) {
+      addOffset = (maxValue + minValue) / 2.0;
+    }
+    std::shared_ptr<monio::Variable> var = fileData.getMetadata().getVariable(writeName);
+    std::shared_ptr<AttributeBase> scaleAttr = std::make_shared<AttributeDouble>(
+                                         std::string(consts::kScaleFactorName), scaleFactor);
+    std::shared_ptr<AttributeBase> offsetAttr = std::make_shared<AttributeDouble>(
+                                         std::string(consts::kAddOffsetName), addOffset);
+    // Written explicitly, so the fill value is outside the packed range for all readers
+    std::shared_ptr<AttributeBase> fillAttr = std::make_shared<AttributeInt>(
+                                         std::string(consts::kFillValueName),
+                                         isShort == true ? consts::kPackedShortFill :
+                                                           consts::kPackedByteFill);
+    var->addAttribute(scaleAttr);
+    var->addAttribute(offsetAttr);
+    var->addAttribute(fillAttr);
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void monio::AtlasWriter::populateMetadataWithField(Metadata& metadata,
                                              const atlas::Field& field,
                                              const consts::FieldMetadata& fieldMetadata,
                                              const std::string& varName,
-                                             const std::string& vertConfigName) {
+                                             const std::string& vertConfigName,
+                                             const consts::LevelRemap& levelRemap) {
   oops::Log::trace() << "AtlasWriter::populateMetadataWithField()" << std::endl;
-  int type = utilsatlas::atlasTypeToMonioEnum(field.datatype());
+  int type = getWriteType(field, fieldMetadata);
   std::shared_ptr<monio::Variable> var = std::make_shared<Variable>(varName, type);
-  // Variable dimensions
-  addVariableDimensions(field, metadata, var, vertConfigName);
-  // Variable attributes
-  for (int i = 0; i < consts::eNumberOfAttributeNames; ++i) {
-    std::string attributeName = std::string(consts::kIncrementAttributeNames[i]);
-    std::string attributeValue;
-    switch (i) {
-      case consts::eStandardName:
-        attributeValue = fieldMetadata.jediName;
-        break;
-      case consts::eLongName:
-        attributeValue = fieldMetadata.jediName + "_inc";
-        break;
-      case consts::eUnitsName:
-        attributeValue = fieldMetadata.units;
-        break;
-      default:
-        attributeValue = consts::kIncrementVariableValues[i];
-    }
-    std::shared_ptr<AttributeBase> incAttr = std::make_shared<AttributeString>(attributeName,
-                                                                               attributeValue);
-    var->addAttribute(incAttr);
+  // Variable dimensions, including any file levels added by the level remap
+  std::vector<atlas::idx_t> fieldShape = field.shape();
+  if (field.metadata().get<bool>("global") == false) {
+    fieldShape[consts::eHorizontal] = utilsatlas::getHorizontalSize(field);
   }
+  fieldShape[consts::eVertical] += static_cast<atlas::idx_t>(levelRemap.levelOffset);
+  addVariableDimensions(fieldShape, metadata, var, vertConfigName);
+  // Variable attributes
+  addVariableAttributes(var, fieldMetadata);
   metadata.addVariable(varName, var);
 }
 
@@ -144,11 +212,14 @@ void monio::AtlasWriter::populateMetadataWithField(Metadata& metadata,
 
 void monio::AtlasWriter::populateDataWithField(Data& data,
                                          const atlas::Field& field,
-                                         const std::vector<size_t>& lfricToAtlasMap,
-                                         const std::string& fieldName) {
+                                         const std::vector<uint32_t>& lfricToAtlasMap,
+                                         const std::string& fieldName,
+                                         const int writeType,
+                                         const consts::LevelRemap& levelRemap) {
   oops::Log::trace() << "AtlasWriter::populateDataWithField()" << std::endl;
   std::shared_ptr<DataContainerBase> dataContainer = nullptr;
-  populateDataContainerWithField(dataContainer, field, lfricToAtlasMap, fieldName);
+  populateDataContainerWithField(dataContainer, field, lfricToAtlasMap, fieldName, writeType,
+                                 levelRemap);
   data.addContainer(dataContainer);
 }
 
@@ -164,14 +235,23 @@ void monio::AtlasWriter::populateDataWithField(Data& data,
 void monio::AtlasWriter::populateDataContainerWithField(
                                      std::shared_ptr<monio::DataContainerBase>& dataContainer,
                                const atlas::Field& field,
-                               const std::vector<size_t>& lfricToAtlasMap,
-                               const std::string& fieldName) {
+                               const std::vector<uint32_t>& lfricToAtlasMap,
+                               const std::string& fieldName,
+                               const int writeType,
+                               const consts::LevelRemap& levelRemap) {
   oops::Log::trace() << "AtlasWriter::populateDataContainerWithField()" << std::endl;
   if (mpiCommunicator_.rank() == mpiRankOwner_) {
     atlas::array::DataType atlasType = field.datatype();
-    atlas::idx_t fieldSize = utilsatlas::getGlobalDataSize(field);
-    switch (atlasType.kind()) {
-      case atlasType.KIND_INT32: {
+    atlas::idx_t fieldSize = static_cast<atlas::idx_t>(lfricToAtlasMap.size() *
+                             (field.shape(consts::eVertical) + levelRemap.levelOffset));
+    // Field data are converted as they are reordered, where the write type differs. Packed data
+    // are held at the field type, and packed as they are written.
+    int containerType = writeType;
+    if (writeType == consts::eShort || writeType == consts::eByte) {
+      containerType = utilsatlas::atlasTypeToMonioEnum(atlasType);
+    }
+    switch (containerType) {
+      case consts::eDataTypes::eInt: {
         if (dataContainer == nullptr) {
           dataContainer = std::make_shared<DataContainerInt>(fieldName);
         }
@@ -179,10 +259,11 @@ void monio::AtlasWriter::populateDataContainerWithField(
                           std::static_pointer_cast<DataContainerInt>(dataContainer);
         dataContainerInt->clear();
         dataContainerInt->setSize(fieldSize);
-        populateDataVec(dataContainerInt->getData(), field, lfricToAtlasMap);
+        populateDataVec<int>(dataContainerInt->getData(), field, lfricToAtlasMap,
+                             levelRemap);
         break;
       }
-      case atlasType.KIND_REAL32: {
+      case consts::eDataTypes::eFloat: {
         if (dataContainer == nullptr) {
           dataContainer = std::make_shared<DataContainerFloat>(fieldName);
         }
@@ -190,10 +271,16 @@ void monio::AtlasWriter::populateDataContainerWithField(
                           std::static_pointer_cast<DataContainerFloat>(dataContainer);
         dataContainerFloat->clear();
         dataContainerFloat->setSize(fieldSize);
-        populateDataVec(dataContainerFloat->getData(), field, lfricToAtlasMap);
+        if (atlasType.kind() == atlasType.KIND_REAL64) {
+          populateDataVec<double>(dataContainerFloat->getData(), field, lfricToAtlasMap,
+                                  levelRemap);
+        } else {
+          populateDataVec<float>(dataContainerFloat->getData(), field, lfricToAtlasMap,
+                                 levelRemap);
+        }
         break;
       }
-      case atlasType.KIND_REAL64: {
+      case consts::eDataTypes::eDouble: {
         if (dataContainer == nullptr) {
           dataContainer = std::make_shared<DataContainerDouble>(fieldName);
         }
@@ -201,7 +288,13 @@ void monio::AtlasWriter::populateDataContainerWithField(
                           std::static_pointer_cast<DataContainerDouble>(dataContainer);
         dataContainerDouble->clear();
         dataContainerDouble->setSize(fieldSize);
-        populateDataVec(dataContainerDouble->getData(), field, lfricToAtlasMap);
+        if (atlasType.kind() == atlasType.KIND_REAL32) {
+          populateDataVec<float>(dataContainerDouble->getData(), field, lfricToAtlasMap,
+                                 levelRemap);
+        } else {
+          populateDataVec<double>(dataContainerDouble->getData(), field, lfricToAtlasMap,
+                                  levelRemap);
+        }
         break;
       }
       default: {
@@ -265,35 +358,46 @@ void monio::AtlasWriter::populateDataContainerWithField(
   }
 }
 
-template<typename T>
-void monio::AtlasWriter::populateDataVec(std::vector<T>& dataVec,
+template<typename T, typename U>
+void monio::AtlasWriter::populateDataVec(std::vector<U>& dataVec,
                                    const atlas::Field& field,
-                                   const std::vector<size_t>& lfricToAtlasMap) {
+                                   const std::vector<uint32_t>& lfricToAtlasMap,
+                                   const consts::LevelRemap& levelRemap) {
   oops::Log::trace() << "AtlasWriter::populateDataVec() " << field.name() << std::endl;
   atlas::idx_t numLevels = field.shape(consts::eVertical);
-  if ((lfricToAtlasMap.size() * numLevels) != dataVec.size()) {
+  if ((lfricToAtlasMap.size() * (numLevels + levelRemap.levelOffset)) != dataVec.size()) {
     Monio::get().closeFiles();
     utils::throwException("AtlasWriter::populateDataVec()> "
                           "Data container is not configured for the expected data...");
   }
-  auto fieldView = atlas::array::make_view<T, 2>(field);
-  for (std::size_t i = 0; i < lfricToAtlasMap.size(); ++i) {
-    for (atlas::idx_t j = 0; j < numLevels; ++j) {
-      atlas::idx_t index = lfricToAtlasMap[i] + (j * lfricToAtlasMap.size());
-      dataVec[index] = fieldView(i, j);
-    }
-  }
+  utilspermute::checkFileIndices(lfricToAtlasMap.data(), lfricToAtlasMap.size(),
+                                 lfricToAtlasMap.size(), "AtlasWriter::populateDataVec()");
+  auto fieldView = atlas::array::make_view<const T, 2>(field);
+  utilspermute::columnsToFileOrder(fieldView.data(), fieldView.stride(consts::eHorizontal),
+                                   lfricToAtlasMap.data(), lfricToAtlasMap.size(), numLevels,
+                                   dataVec.data(), lfricToAtlasMap.size(), levelRemap);
 }
 
 template void monio::AtlasWriter::populateDataVec<double>(std::vector<double>& dataVec,
                                                     const atlas::Field& field,
-                                                    const std::vector<size_t>& lfricToAtlasMap);
+                                                    const std::vector<uint32_t>& lfricToAtlasMap,
+                                                    const consts::LevelRemap& levelRemap);
+template void monio::AtlasWriter::populateDataVec<double>(std::vector<float>& dataVec,
+                                                    const atlas::Field& field,
+                                                    const std::vector<uint32_t>& lfricToAtlasMap,
+                                                    const consts::LevelRemap& levelRemap);
 template void monio::AtlasWriter::populateDataVec<float>(std::vector<float>& dataVec,
                                                    const atlas::Field& field,
-                                                   const std::vector<size_t>& lfricToAtlasMap);
+                                                   const std::vector<uint32_t>& lfricToAtlasMap,
+                                                   const consts::LevelRemap& levelRemap);
+template void monio::AtlasWriter::populateDataVec<float>(std::vector<double>& dataVec,
+                                                   const atlas::Field& field,
+                                                   const std::vector<uint32_t>& lfricToAtlasMap,
+                                                   const consts::LevelRemap& levelRemap);
 template void monio::AtlasWriter::populateDataVec<int>(std::vector<int>& dataVec,
                                                  const atlas::Field& field,
-                                                 const std::vector<size_t>& lfricToAtlasMap);
+                                                 const std::vector<uint32_t>& lfricToAtlasMap,
+                                                 const consts::LevelRemap& levelRemap);
 
 template<typename T>
 void monio::AtlasWriter::populateDataVec(std::vector<T>& dataVec,
@@ -319,82 +423,54 @@ template void monio::AtlasWriter::populateDataVec<int>(std::vector<int>& dataVec
                                                  const atlas::Field& field,
                                                  const std::vector<atlas::idx_t>& dimensions);
 
-atlas::Field monio::AtlasWriter::getWriteField(atlas::Field& field,
-                                         const std::string& writeName,
-                                         const bool noFirstLevel) {
-  oops::Log::trace() << "AtlasWriter::getWriteField()" << std::endl;
-  atlas::FunctionSpace functionSpace = field.functionspace();
+int monio::AtlasWriter::getWriteType(const atlas::Field& field,
+                                     const consts::FieldMetadata& fieldMetadata) {
+  int fieldType = utilsatlas::atlasTypeToMonioEnum(field.datatype());
+  if (fieldMetadata.outputType < 0 || fieldMetadata.outputType == fieldType) {
+    return fieldType;
+  }
+  // Floating-point fields may be written at either precision, or packed as short or byte. Other
+  // conversions are not supported.
+  bool isFieldReal = fieldType == consts::eFloat || fieldType == consts::eDouble;
+  bool isOutputReal = fieldMetadata.outputType == consts::eFloat ||
+                      fieldMetadata.outputType == consts::eDouble ||
+                      fieldMetadata.outputType == consts::eShort ||
+                      fieldMetadata.outputType == consts::eByte;
+  if (isFieldReal == false || isOutputReal == false) {
+    Monio::get().closeFiles();
+    utils::throwException("AtlasWriter::getWriteType()> Output type of \"" +
+                          fieldMetadata.jediName + "\" not supported...");
+  }
+  return fieldMetadata.outputType;
+}
+
+monio::consts::LevelRemap monio::AtlasWriter::getWriteLevelRemap(const atlas::Field& field,
+                                                          const std::string& writeName,
+                                                          const bool noFirstLevel) {
+  oops::Log::trace() << "AtlasWriter::getWriteLevelRemap()" << std::endl;
   atlas::array::DataType atlasType = field.datatype();
   if (atlasType != atlasType.KIND_REAL64 &&
       atlasType != atlasType.KIND_REAL32 &&
       atlasType != atlasType.KIND_INT32) {
       Monio::get().closeFiles();
-      utils::throwException("AtlasWriter::getWriteField())> Data type not coded for...");
+      utils::throwException("AtlasWriter::getWriteLevelRemap()> Data type not coded for...");
   }
   atlas::idx_t numLevels = field.shape(consts::eVertical);
   // Erroneous case. For noFirstLevel == true field should have 70 levels
   if (noFirstLevel == true && numLevels == consts::kVerticalFullSize) {
     Monio::get().closeFiles();
-    utils::throwException("AtlasWriter::getWriteField()> Field levels misconfiguration...");
+    utils::throwException("AtlasWriter::getWriteLevelRemap()> Field levels misconfiguration...");
   }
   // WARNING - This name-check is an LFRic-Lite specific convention...
-  if (utils::findInVector(consts::kMissingVariableNames, writeName) == false) {
-    if (noFirstLevel == true && numLevels == consts::kVerticalHalfSize) {
-      atlas::util::Config atlasOptions = atlas::option::name(writeName) |
-                                         atlas::option::global(0) |
-                                         atlas::option::levels(consts::kVerticalFullSize);
-      switch (atlasType.kind()) {
-        case atlasType.KIND_REAL64: {
-          return copySurfaceLevel<double>(field, functionSpace, atlasOptions);
-        }
-        case atlasType.KIND_REAL32: {
-          return copySurfaceLevel<float>(field, functionSpace, atlasOptions);
-        }
-        case atlasType.KIND_INT32: {
-          return copySurfaceLevel<int>(field, functionSpace, atlasOptions);
-        }
-      }
-    } else {
-      field.metadata().set("name", writeName);
-    }
-  } else {
+  if (utils::findInVector(consts::kMissingVariableNames, writeName) == true) {
     Monio::get().closeFiles();
-    utils::throwException("AtlasWriter::getWriteField()> Field write name misconfiguration...");
-  }
-  return field;
-}
-
-template<typename T>
-atlas::Field monio::AtlasWriter::copySurfaceLevel(const atlas::Field& inputField,
-                              const atlas::FunctionSpace& functionSpace,
-                              const atlas::util::Config& atlasOptions) {
-  oops::Log::trace() << "AtlasWriter::copySurfaceLevel()" << std::endl;
-  atlas::Field copiedField = functionSpace.createField<T>(atlasOptions);
-  auto copiedFieldView = atlas::array::make_view<T, 2>(copiedField);
-  auto inputFieldView = atlas::array::make_view<T, 2>(inputField);
-  std::vector<atlas::idx_t> fieldShape = inputField.shape();
-  for (atlas::idx_t j = 0; j < fieldShape[consts::eVertical]; ++j) {
-    for (atlas::idx_t i = 0; i < fieldShape[consts::eHorizontal]; ++i) {
-      copiedFieldView(i, j + 1) = inputFieldView(i, j);
-    }
-  }
-  // Copy surface level of input field
-  for (atlas::idx_t i = 0; i < fieldShape[consts::eHorizontal]; ++i) {
-    copiedFieldView(i, 0) = inputFieldView(i, 0);
+    utils::throwException("AtlasWriter::getWriteLevelRemap()> "
+                          "Field write name misconfiguration...");
   }
-  return copiedField;
+  // The surface level is written twice for fields without a first level
+  return utils::getLevelRemap(true, noFirstLevel, numLevels);
 }
 
-template atlas::Field monio::AtlasWriter::copySurfaceLevel<double>(const atlas::Field& inputField,
-                                                          const atlas::FunctionSpace& functionSpace,
-                                                          const atlas::util::Config& atlasOptions);
-template atlas::Field monio::AtlasWriter::copySurfaceLevel<float>(const atlas::Field& inputField,
-                                                          const atlas::FunctionSpace& functionSpace,
-                                                          const atlas::util::Config& atlasOptions);
-template atlas::Field monio::AtlasWriter::copySurfaceLevel<int>(const atlas::Field& inputField,
-                                                          const atlas::FunctionSpace& functionSpace,
-                                                          const atlas::util::Config& atlasOptions);
-
 void monio::AtlasWriter::addVariableDimensions(const atlas::Field& field,
                                                const Metadata& metadata,
                                                      std::shared_ptr<monio::Variable> var,
@@ -403,6 +479,13 @@ void monio::AtlasWriter::addVariableDimensions(const atlas::Field& field,
   if (field.metadata().get<bool>("global") == false) {  // If so, get the 2D size of the Field
     fieldShape[consts::eHorizontal] = utilsatlas::getHorizontalSize(field);
   }
+  addVariableDimensions(fieldShape, metadata, var, vertConfigName);
+}
+
+void monio::AtlasWriter::addVariableDimensions(std::vector<atlas::idx_t> fieldShape,
+                                               const Metadata& metadata,
+                                                     std::shared_ptr<monio::Variable> var,
+                                               const std::string& vertConfigName) {
   // Reversal of dims required for LFRic files. Currently applied to all output files.
   std::reverse(fieldShape.begin(), fieldShape.end());
   for (auto& dimSize : fieldShape) {
@@ -419,6 +502,30 @@ void monio::AtlasWriter::addVariableDimensions(const atlas::Field& field,
   }
 }
 
+void monio::AtlasWriter::addVariableAttributes(std::shared_ptr<monio::Variable> var,
+                                               const consts::FieldMetadata& fieldMetadata) {
+  for (int i = 0; i < consts::eNumberOfAttributeNames; ++i) {
+    std::string attributeName = std::string(consts::kIncrementAttributeNames[i]);
+    std::string attributeValue;
+    switch (i) {
+      case consts::eStandardName:
+        attributeValue = fieldMetadata.jediName;
+        break;
+      case consts::eLongName:
+        attributeValue = fieldMetadata.jediName + "_inc";
+        break;
+      case consts::eUnitsName:
+        attributeValue = fieldMetadata.units;
+        break;
+      default:
+        attributeValue = consts::kIncrementVariableValues[i];
+    }
+    std::shared_ptr<AttributeBase> incAttr = std::make_shared<AttributeString>(attributeName,
+                                                                               attributeValue);
+    var->addAttribute(incAttr);
+  }
+}
+
 void monio::AtlasWriter::addGlobalAttributes(Metadata& metadata, const bool isLfricConvention) {
   // Initialise variables
   std::string variableConvention =
@@ -8,6 +8,7 @@
 ******************************************************************************/
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -52,6 +53,33 @@ class AtlasWriter {
                            const atlas::Field& field,
                            const std::string& writeName);
 
+  /// \brief Creates data only from an Atlas field. For serial writes of increments and states,
+  ///        where the metadata of all fields have been created beforehand, with
+  ///        populateMetadataWithDistributedField.
+  void populateDataWithField(FileData& fileData,
+                             atlas::Field& field,
+                       const consts::FieldMetadata& fieldMetadata,
+                       const std::string& writeName,
+                       const bool isLfricConvention);
+
+  /// \brief Creates metadata only for a distributed Atlas field, without gathering it. Used for
+  ///        all increments and states, with LFRic or JEDI names, whose data are then written in
+  ///        serial or in parallel by ParallelWriter.
+  void populateMetadataWithDistributedField(FileData& fileData,
+                                      const atlas::Field& field,
+                                      const consts::FieldMetadata& fieldMetadata,
+                                      const std::string& writeName,
+                                      const std::string& vertConfigName,
+                                      const bool isLfricConvention);
+
+  /// \brief Adds CF packing attributes to a variable written as short or byte, so that the range of
+  ///        the field spans the range of the packed type.
+  void addPackingAttributes(FileData& fileData,
+                      const std::string& writeName,
+                      const int outputType,
+                      const double minValue,
+                      const double maxValue);
+
  private:
   /// \brief Creates additionally required metadata for field. Called from populateFileDataWithField
   ///        where LFRic metadata are provided.
@@ -59,7 +87,8 @@ class AtlasWriter {
                            const atlas::Field& field,
                            const consts::FieldMetadata& fieldMetadata,
                            const std::string& varName,
-                           const std::string& vertConfigName);
+                           const std::string& vertConfigName,
+                           const consts::LevelRemap& levelRemap);
 
   /// \brief Creates all metadata for field. Called from populateFileDataWithField where metadata
   ///        are created.
@@ -71,8 +100,10 @@ class AtlasWriter {
   ///        populateFileDataWithField where LFRic metadata are provided.
   void populateDataWithField(Data& data,
                        const atlas::Field& field,
-                       const std::vector<size_t>& lfricToAtlasMap,
-                       const std::string& fieldName);
+                       const std::vector<uint32_t>& lfricToAtlasMap,
+                       const std::string& fieldName,
+                       const int writeType,
+                       const consts::LevelRemap& levelRemap);
 
   /// \brief Adds populated data container to instance of data. Called from
   ///        populateFileDataWithField where metadata are created.
@@ -80,12 +111,14 @@ class AtlasWriter {
                        const atlas::Field& field,
                        const std::vector<atlas::idx_t>& dimensions);
 
-  /// \brief Derives the container type and makes the call to populate it. Used where metadata are
-  ///        provided and data are written in LFRic order.
+  /// \brief Creates a container of the write type and makes the call to populate it. Used where
+  ///        metadata are provided and data are written in LFRic order.
   void populateDataContainerWithField(std::shared_ptr<monio::DataContainerBase>& dataContainer,
                                 const atlas::Field& field,
-                                const std::vector<size_t>& lfricToAtlasMap,
-                                const std::string& fieldName);
+                                const std::vector<uint32_t>& lfricToAtlasMap,
+                                const std::string& fieldName,
+                                const int writeType,
+                                const consts::LevelRemap& levelRemap);
 
   /// \brief Derives the container type and makes the call to populate it. Used where metadata are
   ///        created as part of the writing process and data are written in Atlas order.
@@ -93,27 +126,27 @@ class AtlasWriter {
                                 const atlas::Field& field,
                                 const std::vector<int>& dimensions);
 
-  /// \brief Iterates through field and populates vector with data from field in LFRic order.
-  template<typename T> void populateDataVec(std::vector<T>& dataVec,
+  /// \brief Iterates through field of type T and populates vector with data from field in LFRic
+  ///        order, placing levels as per the level remap. Data are converted to type U in the same
+  ///        pass, where the types differ.
+  template<typename T, typename U> void populateDataVec(std::vector<U>& dataVec,
                                       const atlas::Field& field,
-                                      const std::vector<size_t>& lfricToAtlasMap);
+                                      const std::vector<uint32_t>& lfricToAtlasMap,
+                                      const consts::LevelRemap& levelRemap);
 
   /// \brief Iterates through field and populates vector with data from field in Atlas order.
   template<typename T> void populateDataVec(std::vector<T>& dataVec,
                                       const atlas::Field& field,
                                       const std::vector<atlas::idx_t>& dimensions);
 
-  /// \brief  Map JEDI fields back into LFRic function space.
-  atlas::Field getWriteField(atlas::Field& inputField,
-                       const std::string& writeName,
-                       const bool noFirstLevel);
+  /// \brief Returns the type a field is written as, from its field metadata.
+  int getWriteType(const atlas::Field& field, const consts::FieldMetadata& fieldMetadata);
 
-  /// \brief Returns a copy of the input field, with an additional level containing a copy of the
-  ///        zeroth level.
-  template<typename T>
-  atlas::Field copySurfaceLevel(const atlas::Field& inputField,
-                                const atlas::FunctionSpace& functionSpace,
-                                const atlas::util::Config& atlasOptions);
+  /// \brief Checks an LFRic field for writing and returns how its levels map to those of the
+  ///        file. Fields without a first level have their surface level written twice.
+  consts::LevelRemap getWriteLevelRemap(const atlas::Field& field,
+                                  const std::string& writeName,
+                                  const bool noFirstLevel);
 
   /// \brief Associates a given variable with its applicable dimensions in the metadata.
   void addVariableDimensions(const atlas::Field& field,
@@ -121,6 +154,16 @@ class AtlasWriter {
                                    std::shared_ptr<monio::Variable> var,
                              const std::string& vertConfigName = "");
 
+  /// \brief Associates a given variable with the dimensions of a field shape, in Atlas order.
+  void addVariableDimensions(std::vector<atlas::idx_t> fieldShape,
+                             const Metadata& metadata,
+                                   std::shared_ptr<monio::Variable> var,
+                             const std::string& vertConfigName = "");
+
+  /// \brief Adds the attributes of an increment variable, as defined in Constants.h.
+  void addVariableAttributes(std::shared_ptr<monio::Variable> var,
+                             const consts::FieldMetadata& fieldMetadata);
+
   void addGlobalAttributes(Metadata& metadata, const bool isLfricConvention = true);
 
   const eckit::mpi::Comm& mpiCommunicator_;
@@ -8,6 +8,7 @@
 ******************************************************************************/
 #pragma once
 
+#include <cstdint>
 #include <numeric>
 #include <string>
 #include <string_view>
@@ -29,6 +30,47 @@ struct FieldMetadata {
   std::string units;
   int numberOfLevels;
   bool noFirstLevel;
+  int outputType = -1;  // Indexed by eDataTypes. Where negative, the type of the field is written
+  int readLevelStart = -1;  // First file level read. Where negative, set by noFirstLevel
+};
+
+/// \brief Storage of variables written to NetCDF-4 files. By default, variables are contiguous and
+///        uncompressed. Compressed variables are chunked by horizontal level, so that a chunk holds
+///        one level of one field. Checksums are not written. Quantisation applies to floating-point
+///        variables only and retains the given number of significant decimal digits, or of
+///        significant bits for eBitRound.
+struct StorageOptions {
+  int compression = 0;  // Indexed by eCompression
+  int compressionLevel = 1;
+  bool isShuffled = true;
+  int quantisation = 0;  // Indexed by eQuantisation
+  int quantisationPrecision = 0;  // Must be set where quantisation is applied
+};
+
+/// \brief Maps the levels of a field to those of a file, where field level j is file level
+///        j + levelOffset. Where isSurfaceCopied is true, file levels below the offset are written
+///        with copies of the first field level. Consumed by the kernels of utilspermute.
+struct LevelRemap {
+  std::size_t levelOffset = 0;
+  bool isSurfaceCopied = false;
+};
+
+/// \brief A block of consecutive levels of a field, identified by its index. Fields are read and
+///        distributed in blocks where the number of levels streamed at once is bounded.
+struct LevelBlock {
+  std::size_t fieldIndex = 0;
+  std::size_t levelStart = 0;
+  std::size_t numLevels = 0;
+};
+
+/// \brief CF packing of a variable, where unpacked = packed * scaleFactor + addOffset. Packed
+///        values lie within +/- packedMax. Missing values, which are NaN when unpacked, are packed
+///        as fillValue.
+struct Packing {
+  double scaleFactor = 1.0;
+  double addOffset = 0.0;
+  double packedMax = 0.0;
+  double fillValue = 0.0;
 };
 
 /// Enums //////////////////////////////////////////////////////////////////////////////////////////
@@ -42,7 +84,9 @@ enum eFieldMetadata {
   eJediVertConfig,
   eUnits,
   eNumberOfLevels,
-  eNoFirstLevel
+  eNoFirstLevel,
+  eOutputType,
+  eReadLevelStart
 };
 
 /// \brief For indexing spatial coordinates and associated data structures, e.g. kLfricCoordVarNames
@@ -51,6 +95,21 @@ enum eAtlasLonLat {
   eLatitude
 };
 
+/// \brief Compression filters applied to variables. Paired with struct StorageOptions, above.
+enum eCompression {
+  eNoCompression,
+  eDeflate,
+  eZstandard
+};
+
+/// \brief Lossy quantisation applied to variables. Paired with struct StorageOptions, above.
+enum eQuantisation {
+  eNoQuantisation,
+  eBitGroom,
+  eGranularBitRound,
+  eBitRound
+};
+
 /// \brief For indexing spatial coordinates of fields generically without reference to the globe.
 enum eDimensions {
   eHorizontal,
@@ -124,6 +183,22 @@ const std::string_view kProducedByName = "produced_by";
 const std::string_view kProducedByString = "MONIO: Met Office NetCDF I/O";
 const std::string_view kVariableConventionName = "variable_convention";
 
+/// \brief CF attributes of packed variables, where unpacked = packed * scale_factor + add_offset.
+const std::string_view kScaleFactorName = "scale_factor";
+const std::string_view kAddOffsetName = "add_offset";
+const std::string_view kFillValueName = "_FillValue";
+/// \brief Largest magnitudes of packed values. Each range is symmetric about zero and excludes the
+///        two most negative values of its type, of which the second is the NetCDF default fill
+///        value, NC_FILL_SHORT or NC_FILL_BYTE. Fill-aware readers treat that value as missing.
+const double kPackedShortMax = 32766.0;
+const double kPackedByteMax = 126.0;
+/// \brief Fill values of packed variables. Equal to NC_FILL_SHORT and NC_FILL_BYTE.
+const int kPackedShortFill = -32767;
+const int kPackedByteFill = -127;
+
+const std::string_view kMapCacheFileId = "MONIOMAP";
+const std::string_view kMapCacheFileExtension = ".lfric_atlas_map";
+
 /// Multi-dimensional String/Views /////////////////////////////////////////////////////////////////
 
 /// \brief Used with eDataTypes, above, for writing metadata to file or console.
@@ -189,13 +264,44 @@ const std::vector<std::string> kCoordVarNames = {std::string(kLongitudeVarName),
 /// Numerical Constants ////////////////////////////////////////////////////////////////////////////
 
 const int kMPIRankOwner = 0;
+/// \brief MPI message tag used to send LFRic-Atlas maps from the owning PE to other I/O ranks.
+const int kMapMessageTag = 100;
 
 const int kVerticalFullSize = 71;
 const int kVerticalHalfSize = 70;
 const int kVertFullNoSurfSize = 70;
 const int kVertHalfWithTopSize = 71;
 
+/// \brief Size with which a dimension is defined as unlimited, as per NC_UNLIMITED.
+const int kUnlimitedDimSize = 0;
+
 const double kVerticalFullInc = 1;
 const double kVerticalHalfInc = 0.5;
+
+/// \brief Incremented whenever the layout of LFRic-Atlas map cache files changes.
+const uint32_t kMapCacheVersion = 2;
+
+/// \brief Number of panels of a cubed-sphere grid. Used where maps are generated in closed form.
+const int kCubedSphereTiles = 6;
+
+/// \brief Gaps between ranges of file indices read by a PE with parallel reads. Smaller gaps are
+///        read through, as fewer, larger reads outperform many small ones.
+const std::size_t kParallelReadMaxGap = 256;
+/// \brief Upper bound in bytes of the global data of a group of fields gathered or scattered in a
+///        single call.
+const std::size_t kFieldGroupBufferSize = 268435456;
+/// \brief Number of groups of fields that may be gathered at once.
+const std::size_t kMaxGathersInFlight = 2;
+/// \brief Default number of fields read ahead of their distribution by each I/O rank.
+const std::size_t kReadBufferCount = 2;
+/// \brief Number of nodes and of levels in each tile of data reordered between Atlas and LFRic
+///        order. Tiles of doubles in both layouts fit comfortably in a 32 KiB L1 cache.
+const std::size_t kPermuteBlockSize = 32;
+/// \brief Number of coordinates checked after generating an LFRic-Atlas map in closed form.
+const int kMapVerificationSamples = 4096;
+/// \brief Greatest quantisation precisions of double-precision variables accepted by NetCDF, as
+///        significant decimal digits and, for eBitRound, significant bits.
+const int kMaxQuantisationDigits = 15;
+const int kMaxQuantisationBits = 52;
 }  // namespace consts
 }  // namespace monio
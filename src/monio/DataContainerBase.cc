@@ -16,3 +16,7 @@ monio::DataContainerBase::DataContainerBase(
 const int monio::DataContainerBase::getType() const {
   return type_;
 }
+
+void monio::DataContainerBase::setName(const std::string& name) {
+  name_ = name;
+}
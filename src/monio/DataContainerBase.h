@@ -28,6 +28,8 @@ class DataContainerBase {
   const int getType() const;
   /// \brief Pure virtual function to prevent this class being instantiated directly.
   virtual const std::string& getName() const = 0;
+  /// \brief Renames the container, so that its storage can be reused for another variable.
+  void setName(const std::string& name);
 
  protected:
   std::string name_;
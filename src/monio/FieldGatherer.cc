@@ -0,0 +1,549 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "FieldGatherer.h"
+
+#include <algorithm>
+
+#include "atlas/array.h"
+#include "atlas/functionspace.h"
+#include "oops/util/Logger.h"
+
+#include "Constants.h"
+#include "DataContainerDouble.h"
+#include "DataContainerFloat.h"
+#include "DataContainerInt.h"
+#include "Monio.h"
+#include "Utils.h"
+#include "UtilsAtlas.h"
+#include "UtilsMpi.h"
+#include "UtilsPermute.h"
+
+monio::FieldGatherer::FieldGatherer(const eckit::mpi::Comm& mpiCommunicator,
+                                    const int mpiRankOwner):
+    mpiCommunicator_(mpiCommunicator),
+    mpiRankOwner_(mpiRankOwner),
+    globalSize_(0),
+    isMapChecked_(false),
+    nextGroup_(0),
+    nextBlock_(0) {
+  oops::Log::trace() << "FieldGatherer::FieldGatherer()" << std::endl;
+}
+
+monio::FieldGatherer::~FieldGatherer() {
+  // Instances are held by the Monio singleton, so are destroyed at exit rather than as exceptions
+  // unwind a write. Every PE posts the same gathers in the same order, and errors raised by MONIO
+  // abort all PEs, so requests are only outstanding where a write was left by an exception from
+  // elsewhere. Where all PEs left it at the same point, the requests complete. Otherwise PEs would
+  // block in the collectives of the write regardless. MPI does not permit nonblocking collectives
+  // to be cancelled or freed, so they are completed here, unless MPI has been finalised.
+  int isFinalized;
+  MPI_Finalized(&isFinalized);
+  if (isFinalized != 0) {
+    return;
+  }
+  for (auto& group : groups_) {
+    if (group.request != MPI_REQUEST_NULL) {
+      MPI_Wait(&group.request, MPI_STATUS_IGNORE);
+    }
+  }
+}
+
+void monio::FieldGatherer::start(const std::vector<atlas::Field>& localFields,
+                                 const std::size_t blockLevels) {
+  oops::Log::trace() << "FieldGatherer::start()" << std::endl;
+  for (auto& group : groups_) {
+    if (group.request != MPI_REQUEST_NULL) {
+      MPI_Wait(&group.request, MPI_STATUS_IGNORE);
+    }
+  }
+  localFields_ = localFields;
+  // Set by createPlan, which is not called where all fields are global
+  globalSize_ = 0;
+  fileIndices_.clear();
+  isMapChecked_ = false;
+  groups_.clear();
+  groupsInFlight_.clear();
+  nextGroup_ = 0;
+  nextBlock_ = 0;
+  for (const auto& localField : localFields_) {
+    if (localField.metadata().get<bool>("global") == false) {
+      createPlan(localField);
+      break;
+    }
+  }
+  createGroups(blockLevels);
+  while (nextGroup_ < groups_.size() && groupsInFlight_.size() < consts::kMaxGathersInFlight) {
+    postGroup(groups_[nextGroup_]);
+    groupsInFlight_.push_back(nextGroup_);
+    nextGroup_++;
+  }
+}
+
+atlas::Field monio::FieldGatherer::next() {
+  oops::Log::trace() << "FieldGatherer::next()" << std::endl;
+  GatherGroup& group = completeGroupsToNext();
+  const std::size_t blockIndex = nextBlock_;
+  const consts::LevelBlock& block = blocks_[blockIndex];
+  const atlas::Field& localField = localFields_[block.fieldIndex];
+  if (block.numLevels != std::size_t(localField.shape(consts::eVertical))) {
+    Monio::get().closeFiles();
+    utils::throwException("FieldGatherer::next()> Field \"" + localField.name() +
+                          "\" is not gathered whole...");
+  }
+  atlas::Field globalField;
+  if (group.isGlobal == true) {
+    globalField = localField;
+  } else {
+    switch (group.dataType) {
+      case consts::eDataTypes::eDouble: {
+        globalField = unpackField<double>(group, blockIndex);
+        break;
+      }
+      case consts::eDataTypes::eFloat: {
+        globalField = unpackField<float>(group, blockIndex);
+        break;
+      }
+      case consts::eDataTypes::eInt: {
+        globalField = unpackField<int>(group, blockIndex);
+        break;
+      }
+    }
+  }
+  finishBlock(group);
+  return globalField;
+}
+
+monio::consts::LevelBlock monio::FieldGatherer::next(
+                                std::shared_ptr<DataContainerBase>& dataContainer,
+                                const std::string& containerName,
+                                const int containerType,
+                                const std::vector<uint32_t>& lfricAtlasMap,
+                                const consts::LevelRemap& levelRemap) {
+  oops::Log::trace() << "FieldGatherer::next()" << std::endl;
+  GatherGroup& group = completeGroupsToNext();
+  const std::size_t blockIndex = nextBlock_;
+  const consts::LevelBlock& block = blocks_[blockIndex];
+  // Levels below the offset are written with the first block only. Later blocks are placed at
+  // their own file levels.
+  consts::LevelRemap blockRemap;
+  consts::LevelBlock fileBlock = {block.fieldIndex, block.levelStart + levelRemap.levelOffset,
+                                  block.numLevels};
+  if (block.levelStart == 0) {
+    blockRemap = levelRemap;
+    fileBlock.levelStart = 0;
+    fileBlock.numLevels += levelRemap.levelOffset;
+  }
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    switch (group.dataType) {
+      case consts::eDataTypes::eDouble: {
+        unpackFieldToContainer<double>(dataContainer, group, blockIndex, containerName,
+                                       containerType, lfricAtlasMap, blockRemap);
+        break;
+      }
+      case consts::eDataTypes::eFloat: {
+        unpackFieldToContainer<float>(dataContainer, group, blockIndex, containerName,
+                                      containerType, lfricAtlasMap, blockRemap);
+        break;
+      }
+      case consts::eDataTypes::eInt: {
+        unpackFieldToContainer<int>(dataContainer, group, blockIndex, containerName,
+                                    containerType, lfricAtlasMap, blockRemap);
+        break;
+      }
+    }
+  }
+  finishBlock(group);
+  return fileBlock;
+}
+
+void monio::FieldGatherer::createPlan(const atlas::Field& field) {
+  oops::Log::trace() << "FieldGatherer::createPlan()" << std::endl;
+  std::vector<int> localGlobalIndices;
+  utilsatlas::getOwnedNodes(field, nodeIndices_, localGlobalIndices);
+  int count = nodeIndices_.size();
+  mpiCommunicator_.gather(count, rankCounts_, mpiRankOwner_);
+  rankOffsets_.assign(mpiCommunicator_.size(), 0);
+  globalSize_ = 0;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    for (std::size_t rank = 0; rank < rankCounts_.size(); ++rank) {
+      rankOffsets_[rank] = globalSize_;
+      globalSize_ += rankCounts_[rank];
+    }
+    globalIndices_.resize(globalSize_);
+  }
+  MPI_Comm mpiComm = MPI_Comm_f2c(mpiCommunicator_.communicator());
+  MPI_Gatherv(localGlobalIndices.data(), count, MPI_INT, globalIndices_.data(),
+              rankCounts_.data(), rankOffsets_.data(), MPI_INT, mpiRankOwner_, mpiComm);
+  mpiCommunicator_.broadcast(globalSize_, mpiRankOwner_);
+}
+
+void monio::FieldGatherer::createGroups(const std::size_t blockLevels) {
+  oops::Log::trace() << "FieldGatherer::createGroups()" << std::endl;
+  blocks_.clear();
+  blockGroupIndices_.clear();
+  blockLevelOffsets_.clear();
+  std::size_t groupSize = 0;
+  for (std::size_t i = 0; i < localFields_.size(); ++i) {
+    const atlas::Field& localField = localFields_[i];
+    const bool isGlobal = localField.metadata().get<bool>("global");
+    const int dataType = utilsatlas::atlasTypeToMonioEnum(localField.datatype());
+    const std::size_t fieldLevels = localField.shape(consts::eVertical);
+    const std::size_t maxBlockLevels = blockLevels != 0 ? blockLevels : fieldLevels;
+    for (std::size_t levelStart = 0; levelStart < fieldLevels; levelStart += maxBlockLevels) {
+      const std::size_t numLevels = std::min(maxBlockLevels, fieldLevels - levelStart);
+      const std::size_t blockSize = globalSize_ * numLevels *
+                                    utilsmpi::getDataTypeSize(dataType);
+      // A group always holds at least one block, whatever its size.
+      if (groups_.size() == 0 || isGlobal == true || groups_.back().isGlobal == true ||
+          groups_.back().dataType != dataType ||
+          groupSize + blockSize > consts::kFieldGroupBufferSize) {
+        groups_.emplace_back();
+        groups_.back().dataType = dataType;
+        groups_.back().isGlobal = isGlobal;
+        groupSize = 0;
+      }
+      groups_.back().blockIndices.push_back(blocks_.size());
+      blockLevelOffsets_.push_back(groups_.back().numLevels);
+      groups_.back().numLevels += numLevels;
+      groupSize += blockSize;
+      blockGroupIndices_.push_back(groups_.size() - 1);
+      blocks_.push_back({i, levelStart, numLevels});
+    }
+  }
+  oops::Log::debug() << "FieldGatherer::createGroups()> " << localFields_.size() <<
+                        " fields in " << blocks_.size() << " blocks and " << groups_.size() <<
+                        " groups" << std::endl;
+}
+
+void monio::FieldGatherer::postGroup(GatherGroup& group) {
+  oops::Log::trace() << "FieldGatherer::postGroup()" << std::endl;
+  if (group.isGlobal == true) {
+    return;
+  }
+  switch (group.dataType) {
+    case consts::eDataTypes::eDouble: {
+      packGroup<double>(group);
+      break;
+    }
+    case consts::eDataTypes::eFloat: {
+      packGroup<float>(group);
+      break;
+    }
+    case consts::eDataTypes::eInt: {
+      packGroup<int>(group);
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("FieldGatherer::postGroup()> Data type not coded for...");
+    }
+  }
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    group.recvCounts.clear();
+    group.recvOffsets.clear();
+    for (std::size_t rank = 0; rank < rankCounts_.size(); ++rank) {
+      group.recvCounts.push_back(rankCounts_[rank] * group.numLevels);
+      group.recvOffsets.push_back(rankOffsets_[rank] * group.numLevels);
+    }
+    group.recvBuffer.resize(globalSize_ * group.numLevels *
+                            utilsmpi::getDataTypeSize(group.dataType));
+  }
+  MPI_Datatype mpiDataType = utilsmpi::getMpiDataType(group.dataType);
+  MPI_Comm mpiComm = MPI_Comm_f2c(mpiCommunicator_.communicator());
+  MPI_Igatherv(group.sendBuffer.data(), nodeIndices_.size() * group.numLevels, mpiDataType,
+               group.recvBuffer.data(), group.recvCounts.data(), group.recvOffsets.data(),
+               mpiDataType, mpiRankOwner_, mpiComm, &group.request);
+}
+
+void monio::FieldGatherer::completeGroup(GatherGroup& group) {
+  oops::Log::trace() << "FieldGatherer::completeGroup()" << std::endl;
+  if (group.isGlobal == true) {
+    return;
+  }
+  MPI_Wait(&group.request, MPI_STATUS_IGNORE);
+  std::vector<unsigned char>().swap(group.sendBuffer);
+}
+
+monio::FieldGatherer::GatherGroup& monio::FieldGatherer::completeGroupsToNext() {
+  oops::Log::trace() << "FieldGatherer::completeGroupsToNext()" << std::endl;
+  if (nextBlock_ >= blocks_.size()) {
+    Monio::get().closeFiles();
+    utils::throwException("FieldGatherer::completeGroupsToNext()> "
+                          "No fields remain to be gathered...");
+  }
+  const std::size_t groupIndex = blockGroupIndices_[nextBlock_];
+  // Groups complete in order. Each completion frees space for the next group to be posted.
+  while (groupsInFlight_.size() != 0 && groupsInFlight_.front() <= groupIndex) {
+    completeGroup(groups_[groupsInFlight_.front()]);
+    groupsInFlight_.pop_front();
+    if (nextGroup_ < groups_.size()) {
+      postGroup(groups_[nextGroup_]);
+      groupsInFlight_.push_back(nextGroup_);
+      nextGroup_++;
+    }
+  }
+  return groups_[groupIndex];
+}
+
+void monio::FieldGatherer::finishBlock(GatherGroup& group) {
+  if (nextBlock_ == group.blockIndices.back()) {
+    std::vector<unsigned char>().swap(group.recvBuffer);
+  }
+  nextBlock_++;
+}
+
+template<typename T>
+void monio::FieldGatherer::packGroup(GatherGroup& group) {
+  oops::Log::trace() << "FieldGatherer::packGroup()" << std::endl;
+  const std::size_t numNodes = nodeIndices_.size();
+  group.sendBuffer.resize(numNodes * group.numLevels * sizeof(T));
+  T* sendData = reinterpret_cast<T*>(group.sendBuffer.data());
+  // Each block occupies owned nodes by its levels, as per Atlas' own layout.
+  std::size_t offset = 0;
+  for (const auto& blockIndex : group.blockIndices) {
+    const consts::LevelBlock& block = blocks_[blockIndex];
+    const std::size_t numLevels = block.numLevels;
+    auto fieldView = atlas::array::make_view<const T, 2>(localFields_[block.fieldIndex]);
+    for (std::size_t node = 0; node < numNodes; ++node) {
+      for (std::size_t j = 0; j < numLevels; ++j) {
+        sendData[offset + (node * numLevels) + j] = fieldView(nodeIndices_[node],
+                                                              block.levelStart + j);
+      }
+    }
+    offset += numNodes * numLevels;
+  }
+}
+
+template void monio::FieldGatherer::packGroup<double>(GatherGroup& group);
+template void monio::FieldGatherer::packGroup<float>(GatherGroup& group);
+template void monio::FieldGatherer::packGroup<int>(GatherGroup& group);
+
+template<typename T>
+atlas::Field monio::FieldGatherer::unpackField(const GatherGroup& group,
+                                               const std::size_t blockIndex) {
+  oops::Log::trace() << "FieldGatherer::unpackField()" << std::endl;
+  const atlas::Field& localField = localFields_[blocks_[blockIndex].fieldIndex];
+  const std::size_t numLevels = localField.shape(consts::eVertical);
+  atlas::util::Config atlasOptions = atlas::option::name(localField.name()) |
+                                     atlas::option::levels(numLevels) |
+                                     atlas::option::datatype(localField.datatype()) |
+                                     atlas::option::global(mpiRankOwner_);
+  atlas::Field globalField = localField.functionspace().createField(atlasOptions);
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    const T* recvData = reinterpret_cast<const T*>(group.recvBuffer.data());
+    const std::size_t levelOffset = blockLevelOffsets_[blockIndex];
+    auto globalView = atlas::array::make_view<T, 2>(globalField);
+    for (std::size_t rank = 0; rank < rankCounts_.size(); ++rank) {
+      const std::size_t numNodes = rankCounts_[rank];
+      const std::size_t rankOffset = rankOffsets_[rank];
+      const T* rankData = recvData + (rankOffset * group.numLevels) + (levelOffset * numNodes);
+      for (std::size_t node = 0; node < numNodes; ++node) {
+        const int globalIndex = globalIndices_[rankOffset + node];
+        for (std::size_t j = 0; j < numLevels; ++j) {
+          globalView(globalIndex, j) = rankData[(node * numLevels) + j];
+        }
+      }
+    }
+  }
+  return globalField;
+}
+
+template atlas::Field monio::FieldGatherer::unpackField<double>(const GatherGroup& group,
+                                                                const std::size_t blockIndex);
+template atlas::Field monio::FieldGatherer::unpackField<float>(const GatherGroup& group,
+                                                               const std::size_t blockIndex);
+template atlas::Field monio::FieldGatherer::unpackField<int>(const GatherGroup& group,
+                                                             const std::size_t blockIndex);
+
+template<typename T>
+void monio::FieldGatherer::unpackFieldToContainer(
+                                 std::shared_ptr<DataContainerBase>& dataContainer,
+                                 const GatherGroup& group,
+                                 const std::size_t blockIndex,
+                                 const std::string& containerName,
+                                 const int containerType,
+                                 const std::vector<uint32_t>& lfricAtlasMap,
+                                 const consts::LevelRemap& levelRemap) {
+  oops::Log::trace() << "FieldGatherer::unpackFieldToContainer()" << std::endl;
+  const atlas::Field& localField = localFields_[blocks_[blockIndex].fieldIndex];
+  const bool isCompatible = group.isGlobal == true ?
+      std::size_t(localField.shape(consts::eHorizontal)) >= lfricAtlasMap.size() :
+      globalSize_ == lfricAtlasMap.size();
+  if (isCompatible == false) {
+    Monio::get().closeFiles();
+    utils::throwException("FieldGatherer::unpackFieldToContainer()> "
+                          "Configured grid is not compatible with the LFRic-Atlas map...");
+  }
+  // The map is shared by all fields of a gather, so is checked once per call to start()
+  if (isMapChecked_ == false) {
+    utilspermute::checkFileIndices(lfricAtlasMap.data(), lfricAtlasMap.size(),
+                                   lfricAtlasMap.size(), "FieldGatherer::unpackFieldToContainer()");
+    isMapChecked_ = true;
+  }
+  const std::size_t dataSize = lfricAtlasMap.size() *
+                               (blocks_[blockIndex].numLevels + levelRemap.levelOffset);
+  if (dataContainer != nullptr && dataContainer->getType() != containerType) {
+    dataContainer = nullptr;
+  }
+  switch (containerType) {
+    case consts::eDataTypes::eDouble: {
+      if (dataContainer == nullptr) {
+        dataContainer = std::make_shared<DataContainerDouble>(containerName);
+      }
+      std::shared_ptr<DataContainerDouble> dataContainerDouble =
+                        std::static_pointer_cast<DataContainerDouble>(dataContainer);
+      dataContainerDouble->setName(containerName);
+      dataContainerDouble->clear();
+      dataContainerDouble->setSize(dataSize);
+      unpackFieldToVec<T>(dataContainerDouble->getData(), group, blockIndex, lfricAtlasMap,
+                          levelRemap);
+      break;
+    }
+    case consts::eDataTypes::eFloat: {
+      if (dataContainer == nullptr) {
+        dataContainer = std::make_shared<DataContainerFloat>(containerName);
+      }
+      std::shared_ptr<DataContainerFloat> dataContainerFloat =
+                        std::static_pointer_cast<DataContainerFloat>(dataContainer);
+      dataContainerFloat->setName(containerName);
+      dataContainerFloat->clear();
+      dataContainerFloat->setSize(dataSize);
+      unpackFieldToVec<T>(dataContainerFloat->getData(), group, blockIndex, lfricAtlasMap,
+                          levelRemap);
+      break;
+    }
+    case consts::eDataTypes::eInt: {
+      if (dataContainer == nullptr) {
+        dataContainer = std::make_shared<DataContainerInt>(containerName);
+      }
+      std::shared_ptr<DataContainerInt> dataContainerInt =
+                        std::static_pointer_cast<DataContainerInt>(dataContainer);
+      dataContainerInt->setName(containerName);
+      dataContainerInt->clear();
+      dataContainerInt->setSize(dataSize);
+      unpackFieldToVec<T>(dataContainerInt->getData(), group, blockIndex, lfricAtlasMap,
+                          levelRemap);
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("FieldGatherer::unpackFieldToContainer()> "
+                            "Data type not coded for...");
+    }
+  }
+}
+
+template void monio::FieldGatherer::unpackFieldToContainer<double>(
+                                 std::shared_ptr<DataContainerBase>& dataContainer,
+                                 const GatherGroup& group,
+                                 const std::size_t blockIndex,
+                                 const std::string& containerName,
+                                 const int containerType,
+                                 const std::vector<uint32_t>& lfricAtlasMap,
+                                 const consts::LevelRemap& levelRemap);
+template void monio::FieldGatherer::unpackFieldToContainer<float>(
+                                 std::shared_ptr<DataContainerBase>& dataContainer,
+                                 const GatherGroup& group,
+                                 const std::size_t blockIndex,
+                                 const std::string& containerName,
+                                 const int containerType,
+                                 const std::vector<uint32_t>& lfricAtlasMap,
+                                 const consts::LevelRemap& levelRemap);
+template void monio::FieldGatherer::unpackFieldToContainer<int>(
+                                 std::shared_ptr<DataContainerBase>& dataContainer,
+                                 const GatherGroup& group,
+                                 const std::size_t blockIndex,
+                                 const std::string& containerName,
+                                 const int containerType,
+                                 const std::vector<uint32_t>& lfricAtlasMap,
+                                 const consts::LevelRemap& levelRemap);
+
+template<typename T, typename U>
+void monio::FieldGatherer::unpackFieldToVec(std::vector<U>& dataVec,
+                                      const GatherGroup& group,
+                                      const std::size_t blockIndex,
+                                      const std::vector<uint32_t>& lfricAtlasMap,
+                                      const consts::LevelRemap& levelRemap) {
+  oops::Log::trace() << "FieldGatherer::unpackFieldToVec()" << std::endl;
+  const consts::LevelBlock& block = blocks_[blockIndex];
+  const std::size_t numLevels = block.numLevels;
+  const std::size_t horizontalSize = lfricAtlasMap.size();
+  if (group.isGlobal == true) {
+    auto fieldView = atlas::array::make_view<const T, 2>(localFields_[block.fieldIndex]);
+    utilspermute::columnsToFileOrder(fieldView.data() + block.levelStart,
+                                     fieldView.stride(consts::eHorizontal),
+                                     lfricAtlasMap.data(), horizontalSize, numLevels,
+                                     dataVec.data(), horizontalSize, levelRemap);
+  } else {
+    // File indices of received columns, in order of PE, are shared by all fields of a gather
+    if (fileIndices_.size() != globalSize_) {
+      fileIndices_.resize(globalSize_);
+      for (std::size_t node = 0; node < globalSize_; ++node) {
+        fileIndices_[node] = lfricAtlasMap[globalIndices_[node]];
+      }
+    }
+    const T* recvData = reinterpret_cast<const T*>(group.recvBuffer.data());
+    const std::size_t groupLevelOffset = blockLevelOffsets_[blockIndex];
+    for (std::size_t rank = 0; rank < rankCounts_.size(); ++rank) {
+      const std::size_t numNodes = rankCounts_[rank];
+      const std::size_t rankOffset = rankOffsets_[rank];
+      const T* rankData = recvData + (rankOffset * group.numLevels) +
+                          (groupLevelOffset * numNodes);
+      utilspermute::columnsToFileOrder(rankData, numLevels, fileIndices_.data() + rankOffset,
+                                       numNodes, numLevels, dataVec.data(), horizontalSize,
+                                       levelRemap);
+    }
+  }
+}
+
+template void monio::FieldGatherer::unpackFieldToVec<double>(std::vector<double>& dataVec,
+                                      const GatherGroup& group,
+                                      const std::size_t blockIndex,
+                                      const std::vector<uint32_t>& lfricAtlasMap,
+                                      const consts::LevelRemap& levelRemap);
+template void monio::FieldGatherer::unpackFieldToVec<double>(std::vector<float>& dataVec,
+                                      const GatherGroup& group,
+                                      const std::size_t blockIndex,
+                                      const std::vector<uint32_t>& lfricAtlasMap,
+                                      const consts::LevelRemap& levelRemap);
+template void monio::FieldGatherer::unpackFieldToVec<double>(std::vector<int>& dataVec,
+                                      const GatherGroup& group,
+                                      const std::size_t blockIndex,
+                                      const std::vector<uint32_t>& lfricAtlasMap,
+                                      const consts::LevelRemap& levelRemap);
+template void monio::FieldGatherer::unpackFieldToVec<float>(std::vector<double>& dataVec,
+                                      const GatherGroup& group,
+                                      const std::size_t blockIndex,
+                                      const std::vector<uint32_t>& lfricAtlasMap,
+                                      const consts::LevelRemap& levelRemap);
+template void monio::FieldGatherer::unpackFieldToVec<float>(std::vector<float>& dataVec,
+                                      const GatherGroup& group,
+                                      const std::size_t blockIndex,
+                                      const std::vector<uint32_t>& lfricAtlasMap,
+                                      const consts::LevelRemap& levelRemap);
+template void monio::FieldGatherer::unpackFieldToVec<float>(std::vector<int>& dataVec,
+                                      const GatherGroup& group,
+                                      const std::size_t blockIndex,
+                                      const std::vector<uint32_t>& lfricAtlasMap,
+                                      const consts::LevelRemap& levelRemap);
+template void monio::FieldGatherer::unpackFieldToVec<int>(std::vector<double>& dataVec,
+                                      const GatherGroup& group,
+                                      const std::size_t blockIndex,
+                                      const std::vector<uint32_t>& lfricAtlasMap,
+                                      const consts::LevelRemap& levelRemap);
+template void monio::FieldGatherer::unpackFieldToVec<int>(std::vector<float>& dataVec,
+                                      const GatherGroup& group,
+                                      const std::size_t blockIndex,
+                                      const std::vector<uint32_t>& lfricAtlasMap,
+                                      const consts::LevelRemap& levelRemap);
+template void monio::FieldGatherer::unpackFieldToVec<int>(std::vector<int>& dataVec,
+                                      const GatherGroup& group,
+                                      const std::size_t blockIndex,
+                                      const std::vector<uint32_t>& lfricAtlasMap,
+                                      const consts::LevelRemap& levelRemap);
@@ -0,0 +1,155 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <mpi.h>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "atlas/field.h"
+#include "eckit/mpi/Comm.h"
+
+#include "Constants.h"
+#include "DataContainerBase.h"
+
+namespace monio {
+/// \brief Gathers many distributed fields onto a single PE for writing. Owned columns only are
+///        sent, so no halo exchange is required. Consecutive fields of the same type are packed
+///        into groups bounded in size by consts::kFieldGroupBufferSize, with one non-blocking
+///        gather per group. Up to consts::kMaxGathersInFlight groups are in flight, so the next
+///        group is packed while earlier ones are communicated and written. Fields may be split
+///        into blocks of levels, so that the owning PE holds one block at a time.
+class FieldGatherer {
+ public:
+  FieldGatherer(const eckit::mpi::Comm& mpiCommunicator,
+                const int mpiRankOwner);
+  ~FieldGatherer();
+
+  FieldGatherer()                                 = delete;  //!< Deleted default constructor
+  FieldGatherer(FieldGatherer&&)                  = delete;  //!< Deleted move constructor
+  FieldGatherer(const FieldGatherer&)             = delete;  //!< Deleted copy constructor
+  FieldGatherer& operator=(FieldGatherer&&)       = delete;  //!< Deleted move assignment
+  FieldGatherer& operator=(const FieldGatherer&)  = delete;  //!< Deleted copy assignment
+
+  /// \brief Starts gathering a list of fields that share a function space. Where blockLevels is
+  ///        non-zero, fields are gathered in blocks of at most blockLevels levels. Collective.
+  void start(const std::vector<atlas::Field>& localFields, const std::size_t blockLevels = 0);
+
+  /// \brief Returns the global version of the next field, in the order passed to start(). The
+  ///        returned field holds data on the owning PE only. Requires fields to be gathered whole.
+  ///        Collective.
+  atlas::Field next();
+
+  /// \brief Places the next block, in order of the fields passed to start() and then of level, in
+  ///        a data container in LFRic order, directly from the received columns and converted to
+  ///        the container type. No global field is created. A passed container of the same type is
+  ///        renamed and its storage reused, otherwise one is created. Levels are placed as per the
+  ///        level remap of the field, which is applied in full where the block starts at the first
+  ///        level. The container is populated on the owning PE only. Returns the file levels held
+  ///        by the container. Collective.
+  consts::LevelBlock next(std::shared_ptr<DataContainerBase>& dataContainer,
+                          const std::string& containerName,
+                          const int containerType,
+                          const std::vector<uint32_t>& lfricAtlasMap,
+                          const consts::LevelRemap& levelRemap);
+
+ private:
+  /// \brief Consecutive blocks of fields of one type, gathered with a single call.
+  struct GatherGroup {
+    std::vector<std::size_t> blockIndices;
+    std::size_t numLevels = 0;  // Sum of the levels of all blocks in the group
+    int dataType;
+    bool isGlobal = false;  // Fields that are already global are returned without a gather
+    std::vector<unsigned char> sendBuffer;
+    std::vector<unsigned char> recvBuffer;
+    std::vector<int> recvCounts;  // Must persist until the gather is complete
+    std::vector<int> recvOffsets;
+    MPI_Request request = MPI_REQUEST_NULL;
+  };
+
+  /// \brief Finds the owned nodes of this PE and gathers their global indices to the owning PE.
+  void createPlan(const atlas::Field& field);
+
+  /// \brief Splits fields into blocks of levels, and blocks into groups by type and
+  ///        consts::kFieldGroupBufferSize.
+  void createGroups(const std::size_t blockLevels);
+
+  /// \brief Packs the owned columns of a group and starts its gather.
+  void postGroup(GatherGroup& group);
+
+  /// \brief Waits for the gather of a group. Received data are held until its last block is taken.
+  void completeGroup(GatherGroup& group);
+
+  /// \brief Completes groups up to that holding the next block, posting further groups as space
+  ///        allows, and returns the group of the next block.
+  GatherGroup& completeGroupsToNext();
+
+  /// \brief Moves on to the next block, releasing the received data of its group after the last.
+  void finishBlock(GatherGroup& group);
+
+  template<typename T> void packGroup(GatherGroup& group);
+
+  /// \brief Creates a global field from the received columns of a field gathered whole.
+  template<typename T> atlas::Field unpackField(const GatherGroup& group,
+                                                const std::size_t blockIndex);
+
+  /// \brief Prepares a container of the container type and makes the call to populate it.
+  template<typename T> void unpackFieldToContainer(
+                                 std::shared_ptr<DataContainerBase>& dataContainer,
+                                 const GatherGroup& group,
+                                 const std::size_t blockIndex,
+                                 const std::string& containerName,
+                                 const int containerType,
+                                 const std::vector<uint32_t>& lfricAtlasMap,
+                                 const consts::LevelRemap& levelRemap);
+
+  /// \brief Places the received columns of a block of type T in a vector of type U in LFRic order.
+  template<typename T, typename U> void unpackFieldToVec(std::vector<U>& dataVec,
+                                                   const GatherGroup& group,
+                                                   const std::size_t blockIndex,
+                                                   const std::vector<uint32_t>& lfricAtlasMap,
+                                                   const consts::LevelRemap& levelRemap);
+
+  const eckit::mpi::Comm& mpiCommunicator_;
+  const std::size_t mpiRankOwner_;
+
+  std::vector<atlas::Field> localFields_;
+
+  /// \brief Local indices of the nodes owned by this PE.
+  std::vector<atlas::idx_t> nodeIndices_;
+  /// \brief Number of owned nodes on each PE, their offsets, and their zero-based global indices in
+  ///        order of PE. Populated on the owning PE only.
+  std::vector<int> rankCounts_;
+  std::vector<int> rankOffsets_;
+  std::vector<int> globalIndices_;
+  /// \brief File indices of the owned nodes in order of PE, derived from the LFRic-Atlas map where
+  ///        fields are placed in LFRic order. Populated on the owning PE only.
+  std::vector<uint32_t> fileIndices_;
+  /// \brief Number of nodes in the global field.
+  std::size_t globalSize_;
+  /// \brief Whether the LFRic-Atlas map has been checked for the fields passed to start().
+  bool isMapChecked_;
+
+  std::vector<GatherGroup> groups_;
+  /// \brief Blocks of levels of all fields, in order of field and then level.
+  std::vector<consts::LevelBlock> blocks_;
+  /// \brief Index of the group holding each block.
+  std::vector<std::size_t> blockGroupIndices_;
+  /// \brief Offset of each block in the levels of its group.
+  std::vector<std::size_t> blockLevelOffsets_;
+  /// \brief Indices of groups that have been posted and not completed, in order.
+  std::deque<std::size_t> groupsInFlight_;
+  std::size_t nextGroup_;
+  std::size_t nextBlock_;
+};
+}  // namespace monio
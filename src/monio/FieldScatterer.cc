@@ -0,0 +1,415 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "FieldScatterer.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "atlas/array.h"
+#include "atlas/functionspace.h"
+#include "oops/util/Logger.h"
+
+#include "Constants.h"
+#include "DataContainerDouble.h"
+#include "DataContainerFloat.h"
+#include "DataContainerInt.h"
+#include "Monio.h"
+#include "Utils.h"
+#include "UtilsAtlas.h"
+#include "UtilsMpi.h"
+#include "UtilsPermute.h"
+
+namespace  {
+  const std::vector<double>& getDataVec(const std::shared_ptr<monio::DataContainerBase>& container,
+                                        const double*) {
+    return std::static_pointer_cast<monio::DataContainerDouble>(container)->getData();
+  }
+
+  const std::vector<float>& getDataVec(const std::shared_ptr<monio::DataContainerBase>& container,
+                                       const float*) {
+    return std::static_pointer_cast<monio::DataContainerFloat>(container)->getData();
+  }
+
+  const std::vector<int>& getDataVec(const std::shared_ptr<monio::DataContainerBase>& container,
+                                     const int*) {
+    return std::static_pointer_cast<monio::DataContainerInt>(container)->getData();
+  }
+}  // namespace
+
+monio::FieldScatterer::FieldScatterer(const eckit::mpi::Comm& mpiCommunicator,
+                                      const int mpiRankOwner):
+    mpiCommunicator_(mpiCommunicator),
+    mpiRankOwner_(mpiRankOwner),
+    horizontalSize_(0),
+    globalSize_(0) {
+  oops::Log::trace() << "FieldScatterer::FieldScatterer()" << std::endl;
+}
+
+void monio::FieldScatterer::createPlan(const atlas::Field& field,
+                                       const std::vector<std::size_t>& ioRanks,
+                                       const std::vector<uint32_t>& lfricAtlasMap) {
+  oops::Log::trace() << "FieldScatterer::createPlan()" << std::endl;
+  std::vector<int> localGlobalIndices;
+  utilsatlas::getOwnedNodes(field, nodeIndices_, localGlobalIndices);
+  int count = nodeIndices_.size();
+  globalSize_ = nodeIndices_.size();
+  mpiCommunicator_.allReduceInPlace(globalSize_, eckit::mpi::sum());
+  rankCounts_.clear();
+  rankOffsets_.clear();
+  fileIndices_.clear();
+  isRankContiguous_.clear();
+  horizontalSize_ = 0;
+  MPI_Comm mpiComm = MPI_Comm_f2c(mpiCommunicator_.communicator());
+  for (const auto& ioRank : ioRanks) {
+    std::vector<int> ioRankCounts;
+    mpiCommunicator_.gather(count, ioRankCounts, ioRank);
+    std::vector<int> ioRankOffsets(mpiCommunicator_.size(), 0);
+    std::vector<int> globalIndices;
+    if (mpiCommunicator_.rank() == ioRank) {
+      for (std::size_t rank = 1; rank < ioRankCounts.size(); ++rank) {
+        ioRankOffsets[rank] = ioRankOffsets[rank - 1] + ioRankCounts[rank - 1];
+      }
+      globalIndices.resize(globalSize_);
+    }
+    MPI_Gatherv(localGlobalIndices.data(), count, MPI_INT, globalIndices.data(),
+                ioRankCounts.data(), ioRankOffsets.data(), MPI_INT, ioRank, mpiComm);
+    if (mpiCommunicator_.rank() == ioRank) {
+      horizontalSize_ = lfricAtlasMap.size();
+      fileIndices_.reserve(globalIndices.size());
+      for (const auto& globalIndex : globalIndices) {
+        if (std::size_t(globalIndex) >= horizontalSize_) {
+          Monio::get().closeFiles();
+          utils::throwException("FieldScatterer::createPlan()> "
+                                "Configured grid is not compatible with the LFRic-Atlas map...");
+        }
+        fileIndices_.push_back(lfricAtlasMap[globalIndex]);
+      }
+      utilspermute::checkFileIndices(fileIndices_.data(), fileIndices_.size(), horizontalSize_,
+                                     "FieldScatterer::createPlan()");
+      rankCounts_ = std::move(ioRankCounts);
+      rankOffsets_ = std::move(ioRankOffsets);
+      for (std::size_t rank = 0; rank < rankCounts_.size(); ++rank) {
+        const uint32_t* rankIndices = fileIndices_.data() + rankOffsets_[rank];
+        bool isContiguous = rankCounts_[rank] > 0;
+        for (int i = 1; i < rankCounts_[rank] && isContiguous == true; ++i) {
+          isContiguous = rankIndices[i] == rankIndices[0] + i;
+        }
+        isRankContiguous_.push_back(isContiguous);
+      }
+    }
+  }
+}
+
+void monio::FieldScatterer::scatter(std::vector<atlas::Field>& localFields,
+                              const std::vector<std::size_t>& sourceRanks,
+                              const DataContainerGetter& getDataContainer,
+                              const std::vector<consts::LevelRemap>& levelRemaps,
+                              const std::size_t blockLevels) {
+  oops::Log::trace() << "FieldScatterer::scatter()" << std::endl;
+  // Each round holds at most one group per source rank, so all I/O ranks send at once.
+  for (auto& groupRound : createGroups(localFields, sourceRanks, blockLevels)) {
+    for (auto& group : groupRound) {
+      postGroup(group, localFields, getDataContainer, levelRemaps);
+    }
+    for (auto& group : groupRound) {
+      completeGroup(group, localFields);
+    }
+  }
+}
+
+std::vector<std::vector<monio::FieldScatterer::ScatterGroup>> monio::FieldScatterer::createGroups(
+                                              const std::vector<atlas::Field>& localFields,
+                                              const std::vector<std::size_t>& sourceRanks,
+                                              const std::size_t blockLevels) {
+  oops::Log::trace() << "FieldScatterer::createGroups()" << std::endl;
+  // Groups are formed per source rank, in order of first appearance.
+  std::vector<std::size_t> orderedSourceRanks;
+  for (const auto& sourceRank : sourceRanks) {
+    if (utils::findInVector(orderedSourceRanks, sourceRank) == false) {
+      orderedSourceRanks.push_back(sourceRank);
+    }
+  }
+  std::vector<std::vector<ScatterGroup>> groupRounds;
+  std::size_t numGroups = 0;
+  std::size_t numBlocks = 0;
+  for (const auto& sourceRank : orderedSourceRanks) {
+    std::vector<ScatterGroup> sourceGroups;
+    std::size_t groupSize = 0;
+    for (std::size_t i = 0; i < localFields.size(); ++i) {
+      if (sourceRanks[i] == sourceRank) {
+        const int dataType = utilsatlas::atlasTypeToMonioEnum(localFields[i].datatype());
+        const std::size_t fieldLevels = localFields[i].shape(consts::eVertical);
+        const std::size_t maxBlockLevels = blockLevels != 0 ? blockLevels : fieldLevels;
+        for (std::size_t levelStart = 0; levelStart < fieldLevels; levelStart += maxBlockLevels) {
+          const std::size_t numLevels = std::min(maxBlockLevels, fieldLevels - levelStart);
+          const std::size_t blockSize = globalSize_ * numLevels *
+                                        utilsmpi::getDataTypeSize(dataType);
+          // A group always holds at least one block, whatever its size.
+          if (sourceGroups.size() == 0 || sourceGroups.back().dataType != dataType ||
+              groupSize + blockSize > consts::kFieldGroupBufferSize) {
+            sourceGroups.emplace_back();
+            sourceGroups.back().sourceRank = sourceRank;
+            sourceGroups.back().dataType = dataType;
+            groupSize = 0;
+          }
+          sourceGroups.back().blocks.push_back({i, levelStart, numLevels});
+          sourceGroups.back().numLevels += numLevels;
+          groupSize += blockSize;
+          numBlocks++;
+        }
+      }
+    }
+    if (groupRounds.size() < sourceGroups.size()) {
+      groupRounds.resize(sourceGroups.size());
+    }
+    for (std::size_t round = 0; round < sourceGroups.size(); ++round) {
+      groupRounds[round].push_back(std::move(sourceGroups[round]));
+    }
+    numGroups += sourceGroups.size();
+  }
+  oops::Log::debug() << "FieldScatterer::createGroups()> " << localFields.size() <<
+                        " fields in " << numBlocks << " blocks and " << numGroups << " groups" <<
+                        std::endl;
+  return groupRounds;
+}
+
+void monio::FieldScatterer::postGroup(ScatterGroup& group,
+                                const std::vector<atlas::Field>& localFields,
+                                const DataContainerGetter& getDataContainer,
+                                const std::vector<consts::LevelRemap>& levelRemaps) {
+  oops::Log::trace() << "FieldScatterer::postGroup()" << std::endl;
+  if (mpiCommunicator_.rank() == group.sourceRank) {
+    switch (group.dataType) {
+      case consts::eDataTypes::eDouble: {
+        packGroup<double>(group, localFields, getDataContainer, levelRemaps);
+        break;
+      }
+      case consts::eDataTypes::eFloat: {
+        packGroup<float>(group, localFields, getDataContainer, levelRemaps);
+        break;
+      }
+      case consts::eDataTypes::eInt: {
+        packGroup<int>(group, localFields, getDataContainer, levelRemaps);
+        break;
+      }
+      default: {
+        Monio::get().closeFiles();
+        utils::throwException("FieldScatterer::postGroup()> Data type not coded for...");
+      }
+    }
+    for (std::size_t rank = 0; rank < rankCounts_.size(); ++rank) {
+      group.sendCounts.push_back(rankCounts_[rank] * group.numLevels);
+      group.sendOffsets.push_back(rankOffsets_[rank] * group.numLevels);
+    }
+  }
+  const std::size_t recvCount = nodeIndices_.size() * group.numLevels;
+  group.recvBuffer.resize(recvCount * utilsmpi::getDataTypeSize(group.dataType));
+  MPI_Datatype mpiDataType = utilsmpi::getMpiDataType(group.dataType);
+  MPI_Comm mpiComm = MPI_Comm_f2c(mpiCommunicator_.communicator());
+  MPI_Iscatterv(group.sendBuffer.data(), group.sendCounts.data(), group.sendOffsets.data(),
+                mpiDataType, group.recvBuffer.data(), recvCount, mpiDataType, group.sourceRank,
+                mpiComm, &group.request);
+}
+
+void monio::FieldScatterer::completeGroup(ScatterGroup& group,
+                                          std::vector<atlas::Field>& localFields) {
+  oops::Log::trace() << "FieldScatterer::completeGroup()" << std::endl;
+  MPI_Wait(&group.request, MPI_STATUS_IGNORE);
+  std::vector<unsigned char>().swap(group.sendBuffer);
+  switch (group.dataType) {
+    case consts::eDataTypes::eDouble: {
+      unpackGroup<double>(group, localFields);
+      break;
+    }
+    case consts::eDataTypes::eFloat: {
+      unpackGroup<float>(group, localFields);
+      break;
+    }
+    case consts::eDataTypes::eInt: {
+      unpackGroup<int>(group, localFields);
+      break;
+    }
+  }
+  std::vector<unsigned char>().swap(group.recvBuffer);
+}
+
+template<typename T>
+void monio::FieldScatterer::packGroup(ScatterGroup& group,
+                                      const std::vector<atlas::Field>& localFields,
+                                      const DataContainerGetter& getDataContainer,
+                                      const std::vector<consts::LevelRemap>& levelRemaps) {
+  oops::Log::trace() << "FieldScatterer::packGroup()" << std::endl;
+  group.sendBuffer.resize(fileIndices_.size() * group.numLevels * sizeof(T));
+  T* sendData = reinterpret_cast<T*>(group.sendBuffer.data());
+  // Each PE receives, for each block, its owned nodes by the levels of the block.
+  std::size_t groupLevelOffset = 0;
+  for (const auto& block : group.blocks) {
+    const std::size_t fieldIndex = block.fieldIndex;
+    const std::size_t numLevels = block.numLevels;
+    // Data hold the file levels of the block only, as per the level remap of the field.
+    const std::size_t fileLevelStart = block.levelStart + levelRemaps[fieldIndex].levelOffset;
+    // Data are requested as they are packed, so need only be read by this point.
+    std::shared_ptr<DataContainerBase> dataContainer = getDataContainer(fieldIndex, fileLevelStart,
+                                                                        numLevels);
+    if (dataContainer == nullptr) {
+      Monio::get().closeFiles();
+      utils::throwException("FieldScatterer::packGroup()> Data for field \"" +
+                            localFields[fieldIndex].name() + "\" are missing...");
+    }
+    // Data are converted to the type of the field as they are permuted, where the types differ.
+    switch (dataContainer->getType()) {
+      case consts::eDataTypes::eDouble: {
+        packField(sendData, getDataVec(dataContainer, static_cast<const double*>(nullptr)),
+                  localFields[fieldIndex], numLevels, group.numLevels, groupLevelOffset);
+        break;
+      }
+      case consts::eDataTypes::eFloat: {
+        packField(sendData, getDataVec(dataContainer, static_cast<const float*>(nullptr)),
+                  localFields[fieldIndex], numLevels, group.numLevels, groupLevelOffset);
+        break;
+      }
+      case consts::eDataTypes::eInt: {
+        packField(sendData, getDataVec(dataContainer, static_cast<const int*>(nullptr)),
+                  localFields[fieldIndex], numLevels, group.numLevels, groupLevelOffset);
+        break;
+      }
+      default: {
+        Monio::get().closeFiles();
+        utils::throwException("FieldScatterer::packGroup()> Data type not coded for...");
+      }
+    }
+    groupLevelOffset += numLevels;
+  }
+}
+
+template void monio::FieldScatterer::packGroup<double>(ScatterGroup& group,
+                                      const std::vector<atlas::Field>& localFields,
+                                      const DataContainerGetter& getDataContainer,
+                                      const std::vector<consts::LevelRemap>& levelRemaps);
+template void monio::FieldScatterer::packGroup<float>(ScatterGroup& group,
+                                      const std::vector<atlas::Field>& localFields,
+                                      const DataContainerGetter& getDataContainer,
+                                      const std::vector<consts::LevelRemap>& levelRemaps);
+template void monio::FieldScatterer::packGroup<int>(ScatterGroup& group,
+                                      const std::vector<atlas::Field>& localFields,
+                                      const DataContainerGetter& getDataContainer,
+                                      const std::vector<consts::LevelRemap>& levelRemaps);
+
+template<typename T, typename U>
+void monio::FieldScatterer::packField(T* sendData,
+                                const std::vector<U>& dataVec,
+                                const atlas::Field& localField,
+                                const std::size_t numLevels,
+                                const std::size_t groupNumLevels,
+                                const std::size_t groupLevelOffset) {
+  oops::Log::trace() << "FieldScatterer::packField()" << std::endl;
+  if (dataVec.size() < horizontalSize_ * numLevels) {
+    Monio::get().closeFiles();
+    utils::throwException("FieldScatterer::packField()> Calculated index exceeds size of "
+                          "data for field \"" + localField.name() + "\".");
+  }
+  // File indices were validated as the plan was created
+  for (std::size_t rank = 0; rank < rankCounts_.size(); ++rank) {
+    const std::size_t numNodes = rankCounts_[rank];
+    const std::size_t rankOffset = rankOffsets_[rank];
+    T* rankData = sendData + (rankOffset * groupNumLevels) + (groupLevelOffset * numNodes);
+    // Atlas holds the levels of each node together, where files hold the nodes of each level
+    // together. The layouts match only for single levels, which need no permutation where the
+    // columns of a PE are contiguous in the file.
+    if (numLevels == 1 && isRankContiguous_[rank] == true) {
+      const U* runData = dataVec.data() + fileIndices_[rankOffset];
+      std::transform(runData, runData + numNodes, rankData,
+                     [](const U value) { return static_cast<T>(value); });
+    } else {
+      utilspermute::fileOrderToColumns(dataVec.data(), horizontalSize_, consts::LevelRemap(),
+                                       fileIndices_.data() + rankOffset, numNodes, numLevels,
+                                       rankData, numLevels);
+    }
+  }
+}
+
+template void monio::FieldScatterer::packField<double>(double* sendData,
+                                const std::vector<double>& dataVec,
+                                const atlas::Field& localField,
+                                const std::size_t numLevels,
+                                const std::size_t groupNumLevels,
+                                const std::size_t groupLevelOffset);
+template void monio::FieldScatterer::packField<double>(double* sendData,
+                                const std::vector<float>& dataVec,
+                                const atlas::Field& localField,
+                                const std::size_t numLevels,
+                                const std::size_t groupNumLevels,
+                                const std::size_t groupLevelOffset);
+template void monio::FieldScatterer::packField<double>(double* sendData,
+                                const std::vector<int>& dataVec,
+                                const atlas::Field& localField,
+                                const std::size_t numLevels,
+                                const std::size_t groupNumLevels,
+                                const std::size_t groupLevelOffset);
+template void monio::FieldScatterer::packField<float>(float* sendData,
+                                const std::vector<double>& dataVec,
+                                const atlas::Field& localField,
+                                const std::size_t numLevels,
+                                const std::size_t groupNumLevels,
+                                const std::size_t groupLevelOffset);
+template void monio::FieldScatterer::packField<float>(float* sendData,
+                                const std::vector<float>& dataVec,
+                                const atlas::Field& localField,
+                                const std::size_t numLevels,
+                                const std::size_t groupNumLevels,
+                                const std::size_t groupLevelOffset);
+template void monio::FieldScatterer::packField<float>(float* sendData,
+                                const std::vector<int>& dataVec,
+                                const atlas::Field& localField,
+                                const std::size_t numLevels,
+                                const std::size_t groupNumLevels,
+                                const std::size_t groupLevelOffset);
+template void monio::FieldScatterer::packField<int>(int* sendData,
+                                const std::vector<double>& dataVec,
+                                const atlas::Field& localField,
+                                const std::size_t numLevels,
+                                const std::size_t groupNumLevels,
+                                const std::size_t groupLevelOffset);
+template void monio::FieldScatterer::packField<int>(int* sendData,
+                                const std::vector<float>& dataVec,
+                                const atlas::Field& localField,
+                                const std::size_t numLevels,
+                                const std::size_t groupNumLevels,
+                                const std::size_t groupLevelOffset);
+template void monio::FieldScatterer::packField<int>(int* sendData,
+                                const std::vector<int>& dataVec,
+                                const atlas::Field& localField,
+                                const std::size_t numLevels,
+                                const std::size_t groupNumLevels,
+                                const std::size_t groupLevelOffset);
+
+template<typename T>
+void monio::FieldScatterer::unpackGroup(ScatterGroup& group,
+                                        std::vector<atlas::Field>& localFields) {
+  oops::Log::trace() << "FieldScatterer::unpackGroup()" << std::endl;
+  const T* recvData = reinterpret_cast<const T*>(group.recvBuffer.data());
+  const std::size_t numNodes = nodeIndices_.size();
+  for (const auto& block : group.blocks) {
+    const std::size_t numLevels = block.numLevels;
+    auto fieldView = atlas::array::make_view<T, 2>(localFields[block.fieldIndex]);
+    for (std::size_t node = 0; node < numNodes; ++node) {
+      for (std::size_t j = 0; j < numLevels; ++j) {
+        fieldView(nodeIndices_[node], block.levelStart + j) = recvData[(node * numLevels) + j];
+      }
+    }
+    recvData += numNodes * numLevels;
+  }
+}
+
+template void monio::FieldScatterer::unpackGroup<double>(ScatterGroup& group,
+                                                         std::vector<atlas::Field>& localFields);
+template void monio::FieldScatterer::unpackGroup<float>(ScatterGroup& group,
+                                                        std::vector<atlas::Field>& localFields);
+template void monio::FieldScatterer::unpackGroup<int>(ScatterGroup& group,
+                                                      std::vector<atlas::Field>& localFields);
@@ -0,0 +1,132 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <mpi.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "atlas/field.h"
+#include "eckit/mpi/Comm.h"
+
+#include "Constants.h"
+#include "DataContainerBase.h"
+
+namespace monio {
+/// \brief Scatters data read in LFRic order on one or more I/O ranks directly into the local
+///        partitions of Atlas fields. Each I/O rank sends every PE a slab holding its owned columns
+///        only, and each PE places the received columns into its own nodes. No global fields are
+///        created and halos are not updated. Fields of the same type read by the same I/O rank are
+///        scattered together, in groups bounded in size by consts::kFieldGroupBufferSize. Fields
+///        may be split into blocks of levels, so that I/O ranks hold one block at a time.
+class FieldScatterer {
+ public:
+  /// \brief Returns the read data of a field, given its index, the first file level and the number
+  ///        of levels required.
+  using DataContainerGetter = std::function<std::shared_ptr<DataContainerBase>(std::size_t,
+                                                                               std::size_t,
+                                                                               std::size_t)>;
+
+  FieldScatterer(const eckit::mpi::Comm& mpiCommunicator,
+                 const int mpiRankOwner);
+
+  FieldScatterer()                                  = delete;  //!< Deleted default constructor
+  FieldScatterer(FieldScatterer&&)                  = delete;  //!< Deleted move constructor
+  FieldScatterer(const FieldScatterer&)             = delete;  //!< Deleted copy constructor
+  FieldScatterer& operator=(FieldScatterer&&)       = delete;  //!< Deleted move assignment
+  FieldScatterer& operator=(const FieldScatterer&)  = delete;  //!< Deleted copy assignment
+
+  /// \brief Sends the global indices of the nodes owned by each PE to every I/O rank, where they
+  ///        are converted to file indices with the LFRic-Atlas map. The map is required on I/O
+  ///        ranks only. Collective.
+  void createPlan(const atlas::Field& field,
+                  const std::vector<std::size_t>& ioRanks,
+                  const std::vector<uint32_t>& lfricAtlasMap);
+
+  /// \brief Scatters the data of each field from the rank that read it. Data are requested on their
+  ///        source ranks only, in order of field index and level, and hold the requested file
+  ///        levels only. File levels are found with the level remap of each field. Where
+  ///        blockLevels is zero, data are requested once per field. Otherwise fields are split into
+  ///        blocks of at most blockLevels levels. Collective.
+  void scatter(std::vector<atlas::Field>& localFields,
+               const std::vector<std::size_t>& sourceRanks,
+               const DataContainerGetter& getDataContainer,
+               const std::vector<consts::LevelRemap>& levelRemaps,
+               const std::size_t blockLevels);
+
+ private:
+  /// \brief Consecutive blocks of fields of one type from one source rank, scattered with a single
+  ///        call.
+  struct ScatterGroup {
+    std::vector<consts::LevelBlock> blocks;
+    std::size_t numLevels = 0;  // Sum of the levels of all blocks in the group
+    std::size_t sourceRank;
+    int dataType;
+    std::vector<unsigned char> sendBuffer;
+    std::vector<unsigned char> recvBuffer;
+    std::vector<int> sendCounts;  // Must persist until the scatter is complete
+    std::vector<int> sendOffsets;
+    MPI_Request request = MPI_REQUEST_NULL;
+  };
+
+  /// \brief Splits fields into blocks of levels, and blocks into groups by source rank, type and
+  ///        consts::kFieldGroupBufferSize. Groups are returned in rounds, each holding at most one
+  ///        group per source rank.
+  std::vector<std::vector<ScatterGroup>> createGroups(
+                                   const std::vector<atlas::Field>& localFields,
+                                   const std::vector<std::size_t>& sourceRanks,
+                                   const std::size_t blockLevels);
+
+  /// \brief Packs the columns of each PE and starts the scatter of a group.
+  void postGroup(ScatterGroup& group,
+                 const std::vector<atlas::Field>& localFields,
+                 const DataContainerGetter& getDataContainer,
+                 const std::vector<consts::LevelRemap>& levelRemaps);
+
+  /// \brief Waits for the scatter of a group and places received columns in local fields.
+  void completeGroup(ScatterGroup& group, std::vector<atlas::Field>& localFields);
+
+  template<typename T> void packGroup(ScatterGroup& group,
+                                      const std::vector<atlas::Field>& localFields,
+                                      const DataContainerGetter& getDataContainer,
+                                      const std::vector<consts::LevelRemap>& levelRemaps);
+  /// \brief Permutes the data of a block of levels of one field into the send buffer of its group,
+  ///        in blocks of the owned nodes of each PE, converting from the read type U to the field
+  ///        type T. Single levels of PEs whose columns are contiguous in the file are copied.
+  template<typename T, typename U> void packField(T* sendData,
+                                            const std::vector<U>& dataVec,
+                                            const atlas::Field& localField,
+                                            const std::size_t numLevels,
+                                            const std::size_t groupNumLevels,
+                                            const std::size_t groupLevelOffset);
+  template<typename T> void unpackGroup(ScatterGroup& group,
+                                        std::vector<atlas::Field>& localFields);
+
+  const eckit::mpi::Comm& mpiCommunicator_;
+  const std::size_t mpiRankOwner_;
+
+  /// \brief Local indices of the nodes owned by this PE.
+  std::vector<atlas::idx_t> nodeIndices_;
+  /// \brief Number of owned nodes on each PE, their offsets, and their indices in the horizontal
+  ///        dimension of the file in order of PE. Populated on I/O ranks only.
+  std::vector<int> rankCounts_;
+  std::vector<int> rankOffsets_;
+  std::vector<uint32_t> fileIndices_;
+  /// \brief Whether the file indices of each PE are consecutive and ascending, so that each level
+  ///        of its columns is a contiguous run of file data. Populated on I/O ranks only.
+  std::vector<bool> isRankContiguous_;
+  /// \brief Size of the horizontal dimension in the file. Populated on I/O ranks only.
+  std::size_t horizontalSize_;
+  /// \brief Number of nodes owned across all PEs.
+  std::size_t globalSize_;
+};
+}  // namespace monio
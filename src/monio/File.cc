@@ -9,6 +9,10 @@
 ******************************************************************************/
 #include "File.h"
 
+#include <netcdf.h>
+#include <netcdf_filter.h>
+#include <netcdf_meta.h>
+
 #include <map>
 #include <memory>
 #include <stdexcept>
@@ -21,6 +25,7 @@
 #include "AttributeString.h"
 #include "Constants.h"
 #include "Utils.h"
+#include "UtilsNetCDF.h"
 #include "Variable.h"
 
 // De/Constructors /////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +38,11 @@ monio::File::File(const std::string& filePath,
     oops::Log::trace() << "File::File(): filePath_> " <<  filePath_  <<
                          ", fileMode_> " << fileMode_ << std::endl;
     dataFile_ = std::make_unique<netCDF::NcFile>(filePath_, fileMode_);
+    // Variables are written in full, so are not first written with fill values
+    if (fileMode_ != netCDF::NcFile::read) {
+      int oldFillMode;
+      netCDF::ncCheck(nc_set_fill(getFile().getId(), NC_NOFILL, &oldFillMode), __FILE__, __LINE__);
+    }
   } catch (netCDF::exceptions::NcException& exception) {
     std::string message = "An exception occurred in File> ";
     message.append(exception.what());
@@ -154,6 +164,22 @@ void monio::File::readVariable(Metadata& metadata, netCDF::NcVar ncVar) {
       var = std::make_shared<Variable>(varName, consts::eInt);
       break;
     }
+    case netCDF::NcType::nc_SHORT:
+    case netCDF::NcType::nc_BYTE: {
+      // Packed variables take the type of their unpacked data, which is that of their attributes
+      std::map<std::string, netCDF::NcVarAtt> ncVarAtts = ncVar.getAtts();
+      auto it = ncVarAtts.find(std::string(consts::kScaleFactorName));
+      if (it == ncVarAtts.end()) {
+        it = ncVarAtts.find(std::string(consts::kAddOffsetName));
+      }
+      if (it != ncVarAtts.end()) {
+        int unpackedType = it->second.getType().getId() == netCDF::NcType::nc_FLOAT ?
+                           consts::eFloat : consts::eDouble;
+        var = std::make_shared<Variable>(varName, unpackedType);
+        break;
+      }
+      [[fallthrough]];  // Unpacked variables of these types are not supported
+    }
     default: {
       close();
       utils::throwException("File::readVariable()> Variable data type " +
@@ -190,7 +216,8 @@ void monio::File::readVariable(Metadata& metadata, netCDF::NcVar ncVar) {
         break;
       }
       case netCDF::NcType::nc_INT:
-      case netCDF::NcType::nc_SHORT: {
+      case netCDF::NcType::nc_SHORT:
+      case netCDF::NcType::nc_BYTE: {
         int intValue;
         ncVarAttr.getValues(&intValue);
         varAttr = std::make_shared<AttributeInt>(ncVarAttr.getName(), intValue);
@@ -268,6 +295,10 @@ void monio::File::readSingleDatum(const std::string& varName,
   if (fileMode_ == netCDF::NcFile::read) {
     auto var = getFile().getVar(varName);
     var.getVar(dataVec.data());
+    consts::Packing packing;
+    if (getPacking(var, packing) == true) {
+      utils::unpackData(dataVec, packing);
+    }
   } else {
     close();
     utils::throwException("File::readSingleDatum()> Write file accessed for reading...");
@@ -290,6 +321,10 @@ void monio::File::readFieldDatum(const std::string& fieldName,
   if (fileMode_ == netCDF::NcFile::read) {
     auto var = getFile().getVar(fieldName);
     var.getVar(startVec, countVec, dataVec.data());
+    consts::Packing packing;
+    if (getPacking(var, packing) == true) {
+      utils::unpackData(dataVec, packing);
+    }
   } else {
     close();
     utils::throwException("File::readFieldDatum()> Write file accessed for reading...");
@@ -317,12 +352,28 @@ void monio::File::writeMetadata(const Metadata& metadata) {
     writeDimensions(metadata);
     writeVariables(metadata);
     writeAttributes(metadata);
+    endDefine();
   } else {
     close();
     utils::throwException("File::writeMetadata()> Read file accessed for writing...");
   }
 }
 
+void monio::File::endDefine() {
+  oops::Log::trace() << "File::endDefine()" << std::endl;
+  int status = nc_enddef(getFile().getId());
+  if (status != NC_NOERR && status != NC_ENOTINDEFINE) {  // Nothing was defined
+    close();
+    utils::throwException("File::endDefine()> An error occurred leaving define mode: " +
+                          std::string(nc_strerror(status)));
+  }
+}
+
+bool monio::File::getPacking(const netCDF::NcVar& ncVar, consts::Packing& packing) {
+  oops::Log::trace() << "File::getPacking()" << std::endl;
+  return utilsnetcdf::getPacking(getFile().getId(), ncVar.getId(), packing);
+}
+
 void monio::File::writeDimensions(const Metadata& metadata) {
   oops::Log::trace() << "File::writeDimensions()" << std::endl;
   if (fileMode_ != netCDF::NcFile::read) {
@@ -350,6 +401,7 @@ void monio::File::writeVariables(const Metadata& metadata) {
         netCDF::NcVar ncVar = getFile().addVar(var->getName(),
                               std::string(consts::kDataTypeNames[var->getType()]),
                               var->getDimensionNames());
+        defineStorage(ncVar, var);
 
         std::map<std::string, std::shared_ptr<AttributeBase>>& varAttrsMap = var->getAttributes();
         for (const auto& varAttrPair : varAttrsMap) {
@@ -366,8 +418,12 @@ void monio::File::writeVariables(const Metadata& metadata) {
             case consts::eDataTypes::eInt: {
               std::shared_ptr<AttributeInt> varAttrInt =
                             std::dynamic_pointer_cast<AttributeInt>(varAttr);
-              ncVar.putAtt(varAttrInt->getName(), netCDF::NcType::nc_INT,
-                           varAttrInt->getValue());
+              // NetCDF requires the fill value to be of the type of its variable
+              netCDF::NcType attrType = netCDF::NcType::nc_INT;
+              if (varAttrInt->getName() == consts::kFillValueName) {
+                attrType = ncVar.getType();
+              }
+              ncVar.putAtt(varAttrInt->getName(), attrType, varAttrInt->getValue());
               break;
             }
             case consts::eDataTypes::eString: {
@@ -391,6 +447,71 @@ void monio::File::writeVariables(const Metadata& metadata) {
   }
 }
 
+void monio::File::defineStorage(netCDF::NcVar& ncVar, std::shared_ptr<Variable> var) {
+  oops::Log::trace() << "File::defineStorage()" << std::endl;
+  const consts::StorageOptions& storageOptions = var->getStorageOptions();
+  if (storageOptions.compression != consts::eNoCompression) {
+    // Dimensions are ordered outermost first, so the horizontal dimension is the last
+    std::vector<size_t> chunkSizes(var->getDimensionsMap().size(), 1);
+    if (chunkSizes.size() != 0) {
+      chunkSizes.back() = var->getDimensionsMap().back().second;
+    }
+    ncVar.setChunking(netCDF::NcVar::nc_CHUNKED, chunkSizes);
+    ncVar.setChecksum(netCDF::NcVar::nc_NOCHECKSUM);
+    switch (storageOptions.compression) {
+      case consts::eDeflate: {
+        ncVar.setCompression(storageOptions.isShuffled, true, storageOptions.compressionLevel);
+        break;
+      }
+      case consts::eZstandard: {
+#if defined(NC_HAS_ZSTD) && NC_HAS_ZSTD == 1
+        ncVar.setCompression(storageOptions.isShuffled, false, 0);
+        netCDF::ncCheck(nc_def_var_zstandard(getFile().getId(), ncVar.getId(),
+                                             storageOptions.compressionLevel), __FILE__, __LINE__);
+        break;
+#else
+        close();
+        utils::throwException("File::defineStorage()> NetCDF has been built without Zstandard...");
+#endif
+      }
+      default: {
+        close();
+        utils::throwException("File::defineStorage()> Compression type not coded for...");
+      }
+    }
+  }
+  if (storageOptions.quantisation != consts::eNoQuantisation &&
+      (var->getType() == consts::eFloat || var->getType() == consts::eDouble)) {
+#if defined(NC_HAS_QUANTIZE) && NC_HAS_QUANTIZE == 1
+    // The library records the applied precision as an attribute of the variable
+    int quantizeMode;
+    switch (storageOptions.quantisation) {
+      case consts::eBitGroom: {
+        quantizeMode = NC_QUANTIZE_BITGROOM;
+        break;
+      }
+      case consts::eGranularBitRound: {
+        quantizeMode = NC_QUANTIZE_GRANULARBR;
+        break;
+      }
+      case consts::eBitRound: {
+        quantizeMode = NC_QUANTIZE_BITROUND;
+        break;
+      }
+      default: {
+        close();
+        utils::throwException("File::defineStorage()> Quantisation type not coded for...");
+      }
+    }
+    netCDF::ncCheck(nc_def_var_quantize(getFile().getId(), ncVar.getId(), quantizeMode,
+                                        storageOptions.quantisationPrecision), __FILE__, __LINE__);
+#else
+    close();
+    utils::throwException("File::defineStorage()> NetCDF has been built without quantisation...");
+#endif
+  }
+}
+
 void monio::File::writeAttributes(const Metadata& metadata) {
   oops::Log::trace() << "File::writeAttributes()" << std::endl;
   if (fileMode_ != netCDF::NcFile::read) {
@@ -438,10 +559,19 @@ void monio::File::writeAttributes(const Metadata& metadata) {
 }
 
 template<typename T>
-void monio::File::writeSingleDatum(const std::string &varName, const std::vector<T>& dataVec) {
+void monio::File::writeSingleDatum(const std::string &varName, std::vector<T>& dataVec) {
   oops::Log::trace() << "File::writeSingleDatum()" << std::endl;
   if (fileMode_ != netCDF::NcFile::read) {
     auto var = getFile().getVar(varName);
+    consts::Packing packing;
+    if (getPacking(var, packing) == true) {
+      std::size_t numClamped = utils::packData(dataVec, packing);
+      if (numClamped > 0) {
+        oops::Log::warning() << "File::writeSingleDatum()> " << numClamped << " values of \""
+                             << varName << "\" lie outside its packed range and are clamped..."
+                             << std::endl;
+      }
+    }
     var.putVar(dataVec.data());
   } else {
     close();
@@ -450,11 +580,48 @@ void monio::File::writeSingleDatum(const std::string &varName, const std::vector
 }
 
 template void monio::File::writeSingleDatum<double>(const std::string& varName,
-                                                    const std::vector<double>& dataVec);
+                                                    std::vector<double>& dataVec);
 template void monio::File::writeSingleDatum<float>(const std::string& varName,
-                                                   const std::vector<float>& dataVec);
+                                                   std::vector<float>& dataVec);
 template void monio::File::writeSingleDatum<int>(const std::string& varName,
-                                                 const std::vector<int>& dataVec);
+                                                 std::vector<int>& dataVec);
+
+template<typename T>
+void monio::File::writeFieldDatum(const std::string& varName,
+                                  const std::vector<size_t>& startVec,
+                                  const std::vector<size_t>& countVec,
+                                  std::vector<T>& dataVec) {
+  oops::Log::trace() << "File::writeFieldDatum()" << std::endl;
+  if (fileMode_ != netCDF::NcFile::read) {
+    auto var = getFile().getVar(varName);
+    consts::Packing packing;
+    if (getPacking(var, packing) == true) {
+      std::size_t numClamped = utils::packData(dataVec, packing);
+      if (numClamped > 0) {
+        oops::Log::warning() << "File::writeFieldDatum()> " << numClamped << " values of \""
+                             << varName << "\" lie outside its packed range and are clamped..."
+                             << std::endl;
+      }
+    }
+    var.putVar(startVec, countVec, dataVec.data());
+  } else {
+    close();
+    utils::throwException("File::writeFieldDatum()> Read file accessed for writing...");
+  }
+}
+
+template void monio::File::writeFieldDatum<double>(const std::string& varName,
+                                                   const std::vector<size_t>& startVec,
+                                                   const std::vector<size_t>& countVec,
+                                                   std::vector<double>& dataVec);
+template void monio::File::writeFieldDatum<float>(const std::string& varName,
+                                                  const std::vector<size_t>& startVec,
+                                                  const std::vector<size_t>& countVec,
+                                                  std::vector<float>& dataVec);
+template void monio::File::writeFieldDatum<int>(const std::string& varName,
+                                                const std::vector<size_t>& startVec,
+                                                const std::vector<size_t>& countVec,
+                                                std::vector<int>& dataVec);
 
 // Other functions /////////////////////////////////////////////////////////////////////////////////
 
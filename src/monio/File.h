@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 
+#include "Constants.h"
 #include "Metadata.h"
 
 namespace monio {
@@ -36,7 +37,7 @@ class File {
   void readMetadata(Metadata& metadata,
               const std::vector<std::string>& varNames);
 
-  /// \brief Read a complete variable.
+  /// \brief Read a complete variable. CF-packed variables are unpacked.
   template<typename T> void readSingleDatum(const std::string& varName,
                                             std::vector<T>& dataVec);
   /// \brief Read a subset of a variable. Usually at different positions in a time series.
@@ -45,10 +46,20 @@ class File {
                                            const std::vector<size_t>& countVec,
                                            std::vector<T>& dataVec);
 
+  /// \brief Defines all dimensions, variables and attributes not yet present in the file, then
+  ///        leaves define mode. Called once with complete metadata, before data are written.
   void writeMetadata(const Metadata& metadata);
 
+  /// \brief Write a complete variable. Where the variable is CF-packed, data are packed in place,
+  ///        so as not to hold a packed copy, and are not valid once written.
   template<typename T> void writeSingleDatum(const std::string& varName,
-                                             const std::vector<T>& dataVec);
+                                             std::vector<T>& dataVec);
+  /// \brief Write a subset of a variable. Where the variable is CF-packed, data are packed in
+  ///        place, as for writeSingleDatum.
+  template<typename T> void writeFieldDatum(const std::string& varName,
+                                            const std::vector<size_t>& startVec,
+                                            const std::vector<size_t>& countVec,
+                                            std::vector<T>& dataVec);
 
  private:
   netCDF::NcFile& getFile();
@@ -63,6 +74,14 @@ class File {
   void writeDimensions(const Metadata& metadata);
   void writeVariables(const Metadata& metadata);
   void writeAttributes(const Metadata& metadata);
+  /// \brief Applies the chunking, compression, checksum and quantisation settings of a variable on
+  ///        definition.
+  void defineStorage(netCDF::NcVar& ncVar, std::shared_ptr<Variable> var);
+  /// \brief Leaves define mode, so that all variables are defined before any data are written.
+  void endDefine();
+
+  /// \brief Returns true where a variable is CF-packed, with its packing.
+  bool getPacking(const netCDF::NcVar& ncVar, consts::Packing& packing);
 
   std::unique_ptr<netCDF::NcFile> dataFile_;
 
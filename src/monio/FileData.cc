@@ -8,6 +8,8 @@
 ******************************************************************************/
 #include "FileData.h"
 
+#include <utility>
+
 monio::FileData::FileData() :
   data_(),
   metadata_() {}
@@ -33,11 +35,11 @@ const monio::Metadata& monio::FileData::getMetadata() const {
   return metadata_;
 }
 
-std::vector<size_t>& monio::FileData::getLfricAtlasMap() {
+std::vector<uint32_t>& monio::FileData::getLfricAtlasMap() {
   return lfricAtlasMap_;
 }
 
-const std::vector<size_t>& monio::FileData::getLfricAtlasMap() const {
+const std::vector<uint32_t>& monio::FileData::getLfricAtlasMap() const {
   return lfricAtlasMap_;
 }
 
@@ -45,10 +47,19 @@ const std::vector<util::DateTime>& monio::FileData::getDateTimes() const {
   return dateTimes_;
 }
 
-void monio::FileData::setLfricAtlasMap(std::vector<size_t> lfricAtlasMap) {
-  lfricAtlasMap_ = lfricAtlasMap;
+const std::unordered_map<std::string, std::size_t>& monio::FileData::getTimeSteps() const {
+  return timeSteps_;
+}
+
+void monio::FileData::setLfricAtlasMap(std::vector<uint32_t> lfricAtlasMap) {
+  lfricAtlasMap_ = std::move(lfricAtlasMap);
 }
 
 void monio::FileData::setDateTimes(std::vector<util::DateTime> dateTimes) {
-  dateTimes_ = dateTimes;
+  dateTimes_ = std::move(dateTimes);
+  timeSteps_.clear();
+  timeSteps_.reserve(dateTimes_.size());
+  for (std::size_t timeStep = 0; timeStep < dateTimes_.size(); ++timeStep) {
+    timeSteps_.emplace(dateTimes_[timeStep].toString(), timeStep);
+  }
 }
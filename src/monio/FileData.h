@@ -8,7 +8,9 @@
 ******************************************************************************/
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "oops/util/DateTime.h"
@@ -32,12 +34,13 @@ class FileData {
   const Data& getData() const;
   Metadata& getMetadata();
   const Metadata& getMetadata() const;
-  std::vector<size_t>& getLfricAtlasMap();
-  const std::vector<size_t>& getLfricAtlasMap() const;
+  std::vector<uint32_t>& getLfricAtlasMap();
+  const std::vector<uint32_t>& getLfricAtlasMap() const;
   const std::vector<util::DateTime>& getDateTimes() const;
+  const std::unordered_map<std::string, std::size_t>& getTimeSteps() const;
 
   void setDate(util::DateTime);
-  void setLfricAtlasMap(std::vector<size_t>);
+  void setLfricAtlasMap(std::vector<uint32_t>);
   void setDateTimes(std::vector<util::DateTime>);
 
  private:
@@ -45,8 +48,10 @@ class FileData {
   Metadata metadata_;
 
   /// \brief Mapping between Atlas and LFRic coordinate/data order, if applicable.
-  std::vector<size_t> lfricAtlasMap_;
+  std::vector<uint32_t> lfricAtlasMap_;
   /// \brief Date-times from read file, if present.
   std::vector<util::DateTime> dateTimes_;
+  /// \brief Time step of each of the date-times, keyed by their string form, for look-up by date.
+  std::unordered_map<std::string, std::size_t> timeSteps_;
 };
 }  // namespace monio
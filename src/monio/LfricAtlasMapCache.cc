@@ -0,0 +1,205 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "LfricAtlasMapCache.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+#include "oops/util/Logger.h"
+
+#include "Constants.h"
+#include "Monio.h"
+#include "Utils.h"
+#include "UtilsAtlas.h"
+
+namespace  {
+  /// \brief 64-bit FNV-1a hash. Used to identify a mesh by its coordinate values.
+  uint64_t hashBytes(const unsigned char* bytes, const size_t size, uint64_t hash) {
+    const uint64_t prime = 1099511628211ULL;
+    for (size_t i = 0; i < size; ++i) {
+      hash ^= bytes[i];
+      hash *= prime;
+    }
+    return hash;
+  }
+}  // namespace
+
+monio::LfricAtlasMapCache::LfricAtlasMapCache() {
+  oops::Log::trace() << "LfricAtlasMapCache::LfricAtlasMapCache()" << std::endl;
+}
+
+monio::LfricAtlasMapCache::~LfricAtlasMapCache() {
+  // Ensures background threads complete before their results are destroyed.
+  for (auto& pendingPair : pendingMaps_) {
+    if (pendingPair.second.valid() == true) {
+      pendingPair.second.wait();
+    }
+  }
+}
+
+void monio::LfricAtlasMapCache::setCacheDirectory(const std::string& cacheDirPath) {
+  oops::Log::trace() << "LfricAtlasMapCache::setCacheDirectory()" << std::endl;
+  cacheDirPath_ = cacheDirPath;
+}
+
+std::string monio::LfricAtlasMapCache::createKey(const std::string& gridName,
+                                         const std::vector<atlas::PointLonLat>& lfricCoords) {
+  oops::Log::trace() << "LfricAtlasMapCache::createKey()" << std::endl;
+  uint64_t hash = 14695981039346656037ULL;  // FNV-1a offset basis
+  for (const auto& lfricCoord : lfricCoords) {
+    double lonLat[2] = {lfricCoord.lon(), lfricCoord.lat()};
+    hash = hashBytes(reinterpret_cast<const unsigned char*>(lonLat), sizeof(lonLat), hash);
+  }
+  std::stringstream keyStream;
+  keyStream << gridName << "_" << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return keyStream.str();
+}
+
+bool monio::LfricAtlasMapCache::findMap(const std::string& key,
+                                        std::vector<uint32_t>& lfricAtlasMap) {
+  oops::Log::trace() << "LfricAtlasMapCache::findMap()" << std::endl;
+  auto pendingIt = pendingMaps_.find(key);
+  if (pendingIt != pendingMaps_.end()) {
+    std::future<std::vector<uint32_t>> pendingMap = std::move(pendingIt->second);
+    pendingMaps_.erase(pendingIt);
+    try {
+      lfricAtlasMaps_[key] = pendingMap.get();
+    } catch (const std::exception& warmException) {
+      // Errors of the warm-up thread are raised on this thread, which closes files and aborts
+      Monio::get().closeFiles();
+      utils::throwException("LfricAtlasMapCache::findMap()> " +
+                            std::string(warmException.what()));
+    }
+  }
+  auto mapIt = lfricAtlasMaps_.find(key);
+  if (mapIt != lfricAtlasMaps_.end()) {
+    lfricAtlasMap = mapIt->second;
+    return true;
+  }
+  if (cacheDirPath_.size() != 0) {
+    std::string filePath = getFilePath(key);
+    if (utils::fileExists(filePath) == true &&
+        readMapFile(filePath, key, lfricAtlasMap) == true) {
+      lfricAtlasMaps_[key] = lfricAtlasMap;
+      return true;
+    }
+  }
+  return false;
+}
+
+void monio::LfricAtlasMapCache::storeMap(const std::string& key,
+                                         const std::vector<uint32_t>& lfricAtlasMap) {
+  oops::Log::trace() << "LfricAtlasMapCache::storeMap()" << std::endl;
+  lfricAtlasMaps_[key] = lfricAtlasMap;
+  if (cacheDirPath_.size() != 0) {
+    writeMapFile(getFilePath(key), key, lfricAtlasMap);
+  }
+}
+
+void monio::LfricAtlasMapCache::warmMap(const std::string& key,
+                                        std::vector<atlas::PointLonLat> atlasCoords,
+                                        std::vector<atlas::PointLonLat> lfricCoords) {
+  oops::Log::trace() << "LfricAtlasMapCache::warmMap()" << std::endl;
+  if (lfricAtlasMaps_.find(key) == lfricAtlasMaps_.end() &&
+      pendingMaps_.find(key) == pendingMaps_.end()) {
+    // Coordinates are checked before the thread is started, so that errors are raised here.
+    utilsatlas::checkLfricAtlasCoords(atlasCoords, lfricCoords);
+    // The file path is resolved here so the thread does not read members that may change.
+    std::string filePath = cacheDirPath_.size() != 0 ? getFilePath(key) : "";
+    pendingMaps_.emplace(key, std::async(std::launch::async,
+        [this, key, filePath, atlasCoords = std::move(atlasCoords),
+                              lfricCoords = std::move(lfricCoords)]() {
+      // Errors neither close files nor abort, and are raised by findMap on the main thread.
+      utils::setBackgroundThread();
+      std::vector<uint32_t> lfricAtlasMap = utilsatlas::createLfricAtlasMap(atlasCoords,
+                                                                          lfricCoords);
+      if (filePath.size() != 0) {
+        writeMapFile(filePath, key, lfricAtlasMap);
+      }
+      return lfricAtlasMap;
+    }));
+  }
+}
+
+std::string monio::LfricAtlasMapCache::getFilePath(const std::string& key) {
+  return cacheDirPath_ + "/" + key + std::string(consts::kMapCacheFileExtension);
+}
+
+bool monio::LfricAtlasMapCache::readMapFile(const std::string& filePath,
+                                            const std::string& key,
+                                            std::vector<uint32_t>& lfricAtlasMap) {
+  oops::Log::trace() << "LfricAtlasMapCache::readMapFile()" << std::endl;
+  std::ifstream mapFile(filePath, std::ios::binary);
+  std::string fileId(consts::kMapCacheFileId.size(), ' ');
+  uint32_t version = 0;
+  uint32_t keySize = 0;
+  mapFile.read(&fileId[0], fileId.size());
+  mapFile.read(reinterpret_cast<char*>(&version), sizeof(version));
+  mapFile.read(reinterpret_cast<char*>(&keySize), sizeof(keySize));
+  if (mapFile.good() == false ||
+      fileId != consts::kMapCacheFileId ||
+      version != consts::kMapCacheVersion || keySize != key.size()) {
+    oops::Log::info() << "LfricAtlasMapCache::readMapFile()> Ignoring incompatible cache file \""
+                      << filePath << "\"..." << std::endl;
+    return false;
+  }
+  std::string fileKey(keySize, ' ');
+  uint64_t mapSize = 0;
+  mapFile.read(&fileKey[0], keySize);
+  mapFile.read(reinterpret_cast<char*>(&mapSize), sizeof(mapSize));
+  if (mapFile.good() == false || fileKey != key) {
+    return false;
+  }
+  lfricAtlasMap.resize(mapSize);
+  mapFile.read(reinterpret_cast<char*>(lfricAtlasMap.data()), mapSize * sizeof(uint32_t));
+  if (mapFile.good() == false) {
+    oops::Log::info() << "LfricAtlasMapCache::readMapFile()> Ignoring truncated cache file \""
+                      << filePath << "\"..." << std::endl;
+    lfricAtlasMap.clear();
+    return false;
+  }
+  // Entries index data of the same size, so any larger value indicates a corrupted file.
+  for (const auto& mapEntry : lfricAtlasMap) {
+    if (mapEntry >= mapSize) {
+      oops::Log::info() << "LfricAtlasMapCache::readMapFile()> Ignoring corrupted cache file \""
+                        << filePath << "\"..." << std::endl;
+      lfricAtlasMap.clear();
+      return false;
+    }
+  }
+  return true;
+}
+
+void monio::LfricAtlasMapCache::writeMapFile(const std::string& filePath,
+                                             const std::string& key,
+                                             const std::vector<uint32_t>& lfricAtlasMap) {
+  // Written to a temporary file and renamed so concurrent jobs never read a partial file.
+  std::string tempFilePath = filePath + "." + std::to_string(getpid()) + ".tmp";
+  std::ofstream mapFile(tempFilePath, std::ios::binary | std::ios::trunc);
+  uint32_t version = consts::kMapCacheVersion;
+  uint32_t keySize = key.size();
+  uint64_t mapSize = lfricAtlasMap.size();
+  mapFile.write(consts::kMapCacheFileId.data(), consts::kMapCacheFileId.size());
+  mapFile.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  mapFile.write(reinterpret_cast<const char*>(&keySize), sizeof(keySize));
+  mapFile.write(key.data(), keySize);
+  mapFile.write(reinterpret_cast<const char*>(&mapSize), sizeof(mapSize));
+  mapFile.write(reinterpret_cast<const char*>(lfricAtlasMap.data()), mapSize * sizeof(uint32_t));
+  mapFile.close();
+  if (mapFile.good() == false || std::rename(tempFilePath.c_str(), filePath.c_str()) != 0) {
+    // A failure to cache is not fatal. The map is recreated next time.
+    std::remove(tempFilePath.c_str());
+  }
+}
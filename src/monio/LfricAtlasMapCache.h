@@ -0,0 +1,72 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <future>  // NOLINT(build/c++11)
+#include <map>
+#include <string>
+#include <vector>
+
+#include "atlas/util/Point.h"
+
+namespace monio {
+/// \brief Holds maps between LFRic and Atlas horizontal ordering so they are only created once per
+///        mesh. Maps are keyed by grid name and a hash of the LFRic mesh coordinates. Maps are kept
+///        in memory and, where a cache directory is set, as versioned binary files on disk.
+class LfricAtlasMapCache {
+ public:
+  LfricAtlasMapCache();
+  ~LfricAtlasMapCache();
+
+  LfricAtlasMapCache(LfricAtlasMapCache&&)                 = delete;  //!< Deleted move constructor
+  LfricAtlasMapCache(const LfricAtlasMapCache&)            = delete;  //!< Deleted copy constructor
+  LfricAtlasMapCache& operator=(LfricAtlasMapCache&&)      = delete;  //!< Deleted move assignment
+  LfricAtlasMapCache& operator=(const LfricAtlasMapCache&) = delete;  //!< Deleted copy assignment
+
+  /// \brief Enables the on-disk cache. An empty path disables it.
+  void setCacheDirectory(const std::string& cacheDirPath);
+
+  /// \brief Returns the key for a grid and the LFRic mesh coordinates read from file.
+  std::string createKey(const std::string& gridName,
+                        const std::vector<atlas::PointLonLat>& lfricCoords);
+
+  /// \brief Searches memory, pending warm-ups and then disk. Returns true if a map was found.
+  bool findMap(const std::string& key, std::vector<uint32_t>& lfricAtlasMap);
+
+  /// \brief Stores a map in memory and, if enabled, on disk.
+  void storeMap(const std::string& key, const std::vector<uint32_t>& lfricAtlasMap);
+
+  /// \brief Creates a map on a background thread. Coordinates are taken by value as they are owned
+  ///        by the thread, and are checked before it starts. The result is collected by the next
+  ///        call to findMap with the same key, which raises any error of the thread.
+  void warmMap(const std::string& key,
+               std::vector<atlas::PointLonLat> atlasCoords,
+               std::vector<atlas::PointLonLat> lfricCoords);
+
+ private:
+  std::string getFilePath(const std::string& key);
+
+  bool readMapFile(const std::string& filePath,
+                   const std::string& key,
+                   std::vector<uint32_t>& lfricAtlasMap);
+
+  void writeMapFile(const std::string& filePath,
+                    const std::string& key,
+                    const std::vector<uint32_t>& lfricAtlasMap);
+
+  /// \brief Directory for cache files. Disk caching is disabled where this is empty.
+  std::string cacheDirPath_;
+
+  /// \brief Maps created or read during this run.
+  std::map<std::string, std::vector<uint32_t>> lfricAtlasMaps_;
+  /// \brief Maps being created by background warm-up.
+  std::map<std::string, std::future<std::vector<uint32_t>>> pendingMaps_;
+};
+}  // namespace monio
@@ -8,7 +8,10 @@
 ******************************************************************************/
 #include "Monio.h"
 
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "atlas/parallel/mpi/mpi.h"
@@ -17,6 +20,7 @@
 
 #include "AttributeString.h"
 #include "Constants.h"
+#include "DataContainerDouble.h"
 #include "Utils.h"
 #include "UtilsAtlas.h"
 #include "Writer.h"
@@ -26,7 +30,14 @@ namespace  {
     std::vector<std::string> dateTimeSplit = monio::utils::strToWords(lfricDateTimeStr, ' ');
     return dateTimeSplit[0] + "T" + dateTimeSplit[1] + "Z";
   }
-}
+
+  std::string convertToLfricDateTimeStr(const util::DateTime& dateTime) {
+    std::string lfricDateTimeStr = dateTime.toString();  // Of the form YYYY-MM-DDThh:mm:ssZ
+    lfricDateTimeStr.replace(lfricDateTimeStr.find('T'), 1, " ");
+    lfricDateTimeStr.pop_back();
+    return lfricDateTimeStr;
+  }
+}  // namespace
 
 monio::Monio& monio::Monio::get() {
   oops::Log::trace() << "Monio::get()" << std::endl;
@@ -48,59 +59,100 @@ void monio::Monio::readState(atlas::FieldSet& localFieldSet,
                             const std::string& filePath,
                             const util::DateTime& dateTime) {
   oops::Log::trace() << "Monio::readState()" << std::endl;
-  if (localFieldSet.size() == 0) {
+  std::vector<atlas::FieldSet> localFieldSets = {localFieldSet};
+  readStates(localFieldSets, fieldMetadataVec, filePath, {dateTime});
+}
+
+void monio::Monio::readStates(std::vector<atlas::FieldSet>& localFieldSets,
+                              const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                              const std::string& filePath,
+                              const std::vector<util::DateTime>& dateTimes) {
+  oops::Log::trace() << "Monio::readStates()" << std::endl;
+  if (localFieldSets.size() == 0 || localFieldSets.size() != dateTimes.size()) {
     Monio::get().closeFiles();
-    utils::throwException("Monio::readState()> localFieldSet has zero fields...");
+    utils::throwException("Monio::readStates()> Number of field sets does not match number of "
+                          "date-times...");
+  }
+  for (const auto& localFieldSet : localFieldSets) {
+    if (localFieldSet.size() == 0) {
+      Monio::get().closeFiles();
+      utils::throwException("Monio::readStates()> localFieldSet has zero fields...");
+    }
   }
   if (filePath.length() != 0) {
     if (utils::fileExists(filePath)) {
       try {
-        for (const auto& fieldMetadata : fieldMetadataVec) {
-          auto& localField = localFieldSet[fieldMetadata.jediName];
-          atlas::Field globalField = utilsatlas::getGlobalField(localField);
-          if (mpiCommunicator_.rank() == mpiRankOwner_) {
-            auto& functionSpace = globalField.functionspace();
-            auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
-            // Initialise file
-            int variableConvention = initialiseFile(grid.name(), filePath, true);
-            // getFileData returns a copy of FileData (with required LFRic mesh data), so read data
-            // is discarded when FileData goes out-of-scope for reading subsequent fields.
-            FileData fileData = getFileData(grid.name());
-            // Configure read name
-            std::string readName = fieldMetadata.lfricReadName;
-            if (variableConvention == consts::eJediConvention) {
-              readName = fieldMetadata.jediName;
-            }
-            if (utils::findInVector(consts::kMissingVariableNames, readName) == false) {
-              oops::Log::trace() << "Monio::readState() processing data for> \"" <<
-                                    readName << "\"..." << std::endl;
-              // Read fields into memory
-              reader_.readDatumAtTime(fileData, readName, dateTime,
-                                      std::string(consts::kTimeDimName));
-              atlasReader_.populateFieldWithFileData(globalField, fileData, fieldMetadata, readName,
-                                                    variableConvention == consts::eLfricConvention);
-            } else {
-              oops::Log::info() << "Monio::readState()> Variable \"" + fieldMetadata.jediName +
-                                   "\" not defined in LFRic. Skipping read..." << std::endl;
+        auto& functionSpace = localFieldSets[0][0].functionspace();
+        auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
+        // Initialise file once per call. The open file, mesh data, date-times and LFRic-Atlas map
+        // are held in the stored FileData and re-used for every field and time read below.
+        int variableConvention = initialiseFile(grid, filePath, true);
+        // Time steps are found by date on the owning PE, where date-times are held.
+        std::vector<std::size_t> timeSteps(dateTimes.size(), 0);
+        if (mpiCommunicator_.rank() == mpiRankOwner_) {
+          for (std::size_t i = 0; i < dateTimes.size(); ++i) {
+            timeSteps[i] = reader_.findTimeStep(getStoredFileData(grid.name()), dateTimes[i]);
+          }
+        }
+        if (isParallelRead_ == true) {
+          getReader().closeFile();
+          readFieldsInParallel(localFieldSets, fieldMetadataVec, filePath, grid.name(),
+                               variableConvention, timeSteps);
+          return;
+        }
+        // All PEs require the convention to find the fields that will be read, and the time steps
+        // to find those read together.
+        mpiCommunicator_.broadcast(variableConvention, mpiRankOwner_);
+        mpiCommunicator_.broadcast(timeSteps, mpiRankOwner_);
+        std::vector<std::size_t> sourceRanks = assignFieldsToIORanks(localFieldSets[0],
+                                                                     fieldMetadataVec);
+        std::vector<bool> isFieldRead(fieldMetadataVec.size(), false);
+        std::vector<std::string> readNames(fieldMetadataVec.size());
+        std::vector<std::size_t> readIndices;  // Fields read by this PE, in order
+        for (std::size_t i = 0; i < fieldMetadataVec.size(); ++i) {
+          const consts::FieldMetadata& fieldMetadata = fieldMetadataVec[i];
+          // Configure read name
+          readNames[i] = fieldMetadata.lfricReadName;
+          if (variableConvention == consts::eJediConvention) {
+            readNames[i] = fieldMetadata.jediName;
+          }
+          if (utils::findInVector(consts::kMissingVariableNames, readNames[i]) == false) {
+            isFieldRead[i] = true;
+            if (mpiCommunicator_.rank() == sourceRanks[i]) {
+              readIndices.push_back(i);
             }
+          } else if (mpiCommunicator_.rank() == mpiRankOwner_) {
+            oops::Log::info() << "Monio::readStates()> Variable \"" + fieldMetadata.jediName +
+                                 "\" not defined in LFRic. Skipping read..." << std::endl;
           }
-          auto& functionSpace = globalField.functionspace();
-          functionSpace.scatter(globalField, localField);
-          localField.haloExchange();
         }
-        reader_.closeFile();
+        // Field sets of consecutive time steps are read together, where fields are read whole.
+        std::size_t runStart = 0;
+        for (std::size_t i = 1; i <= timeSteps.size(); ++i) {
+          if (i == timeSteps.size() || readBlockLevels_ != 0 ||
+              timeSteps[i] != timeSteps[i - 1] + 1) {
+            std::vector<atlas::FieldSet> runFieldSets(localFieldSets.begin() + runStart,
+                                                      localFieldSets.begin() + i);
+            readFieldsInSerial(runFieldSets, fieldMetadataVec, sourceRanks, readIndices,
+                               readNames, isFieldRead, grid.name(), variableConvention,
+                               timeSteps[runStart]);
+            runStart = i;
+          }
+        }
+        getReader().closeFile();
       } catch (netCDF::exceptions::NcException& exception) {
         Monio::get().closeFiles();
         std::string exceptionMessage = exception.what();
-        utils::throwException("Monio::readState()> An exception has occurred: " + exceptionMessage);
+        utils::throwException("Monio::readStates()> An exception has occurred: " +
+                              exceptionMessage);
       }
     } else {
       Monio::get().closeFiles();
-      utils::throwException("Monio::readState()> File \"" + filePath + "\" does not exist...");
+      utils::throwException("Monio::readStates()> File \"" + filePath + "\" does not exist...");
     }
   } else {
     Monio::get().closeFiles();
-    utils::throwException("Monio::readState()> No file path supplied...");
+    utils::throwException("Monio::readStates()> No file path supplied...");
   }
 }
 
@@ -115,35 +167,39 @@ void monio::Monio::readIncrements(atlas::FieldSet& localFieldSet,
   if (filePath.length() != 0) {
     if (utils::fileExists(filePath)) {
       try {
-        for (const auto& fieldMetadata : fieldMetadataVec) {
-          auto& localField = localFieldSet[fieldMetadata.jediName];
-          atlas::Field globalField = utilsatlas::getGlobalField(localField);
-          if (mpiCommunicator_.rank() == mpiRankOwner_) {
-            auto& functionSpace = globalField.functionspace();
-            auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
-
-            // Initialise file
-            int variableConvention = initialiseFile(grid.name(), filePath);
-            // getFileData returns a copy of FileData (with required LFRic mesh data), so read data
-            // is discarded when FileData goes out-of-scope for reading subsequent fields.
-            FileData fileData = getFileData(grid.name());
-            // Configure read name
-            std::string readName = fieldMetadata.lfricReadName;
-            if (variableConvention == consts::eJediConvention) {
-              readName = fieldMetadata.jediName;
-            }
-            oops::Log::trace() << "Monio::readIncrements() processing data for> \"" <<
-                                  readName << "\"..." << std::endl;
-            // Read fields into memory
-            reader_.readFullDatum(fileData, readName);
-            atlasReader_.populateFieldWithFileData(globalField, fileData, fieldMetadata, readName,
-                                                   variableConvention == consts::eLfricConvention);
+        auto& functionSpace = localFieldSet[0].functionspace();
+        auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
+        // Initialise file once per call. The open file, mesh data and LFRic-Atlas map are held in
+        // the stored FileData and re-used for every field read below.
+        int variableConvention = initialiseFile(grid, filePath);
+        if (isParallelRead_ == true) {
+          getReader().closeFile();
+          std::vector<atlas::FieldSet> localFieldSets = {localFieldSet};
+          readFieldsInParallel(localFieldSets, fieldMetadataVec, filePath, grid.name(),
+                               variableConvention, {0});
+          return;
+        }
+        // All PEs require the convention to find the fields that will be read.
+        mpiCommunicator_.broadcast(variableConvention, mpiRankOwner_);
+        std::vector<std::size_t> sourceRanks = assignFieldsToIORanks(localFieldSet,
+                                                                     fieldMetadataVec);
+        std::vector<bool> isFieldRead(fieldMetadataVec.size(), true);
+        std::vector<std::string> readNames(fieldMetadataVec.size());
+        std::vector<std::size_t> readIndices;  // Fields read by this PE, in order
+        for (std::size_t i = 0; i < fieldMetadataVec.size(); ++i) {
+          // Configure read name
+          readNames[i] = fieldMetadataVec[i].lfricReadName;
+          if (variableConvention == consts::eJediConvention) {
+            readNames[i] = fieldMetadataVec[i].jediName;
+          }
+          if (mpiCommunicator_.rank() == sourceRanks[i]) {
+            readIndices.push_back(i);
           }
-          auto& functionSpace = globalField.functionspace();
-          functionSpace.scatter(globalField, localField);
-          localField.haloExchange();
         }
-        reader_.closeFile();
+        std::vector<atlas::FieldSet> localFieldSets = {localFieldSet};
+        readFieldsInSerial(localFieldSets, fieldMetadataVec, sourceRanks, readIndices, readNames,
+                           isFieldRead, grid.name(), variableConvention, 0);
+        getReader().closeFile();
       } catch (netCDF::exceptions::NcException& exception) {
         Monio::get().closeFiles();
         std::string exceptionMessage = exception.what();
@@ -178,40 +234,17 @@ void monio::Monio::writeIncrements(const atlas::FieldSet& localFieldSet,
       if (isLfricConvention == false) {
         addJediData(fileData);
       }
-      writer_.openFile(filePath);
-      for (const auto& fieldMetadata : fieldMetadataVec) {
-        auto& localField = localFieldSet[fieldMetadata.jediName];
-        atlas::Field globalField = utilsatlas::getGlobalField(localField);
-        if (mpiCommunicator_.rank() == mpiRankOwner_) {
-          // Configure write name
-          std::string writeName;
-          std::string verticalConfigName;
-          if (isLfricConvention == true) {
-            writeName = fieldMetadata.lfricWriteName;
-            verticalConfigName = fieldMetadata.lfricVertConfig;
-          } else if (isLfricConvention == false && fieldMetadata.jediName == globalField.name()) {
-            writeName = fieldMetadata.jediName;
-            verticalConfigName = fieldMetadata.jediVertConfig;
-          } else {
-            Monio::get().closeFiles();
-            utils::throwException("Monio::writeIncrements()> "
-                                  "Field metadata configuration error...");
-          }
-          oops::Log::trace() << "Monio::writeIncrements() processing data for> \"" <<
-                                writeName << "\"..." << std::endl;
-
-          atlasWriter_.populateFileDataWithField(fileData,
-                                                 globalField,
-                                                 fieldMetadata,
-                                                 writeName,
-                                                 verticalConfigName,
-                                                 isLfricConvention);
-          writer_.writeMetadata(fileData.getMetadata());
-          writer_.writeData(fileData);
-          fileData.clearData();  // Written and globalised field data no longer required
-        }
+      // All variables are defined before any field is gathered, so that the file is defined once
+      std::vector<std::string> writeNames = defineFields(localFieldSet, fieldMetadataVec, fileData,
+                                                         isLfricConvention, true);
+      if (isParallelWrite_ == true) {
+        writeBehind_.wait();
+        writeFieldsInParallel(localFieldSet, fieldMetadataVec, writeNames, filePath, fileData,
+                              isLfricConvention);
+      } else {
+        writeFieldsInSerial(localFieldSet, fieldMetadataVec, writeNames, filePath, fileData,
+                            isLfricConvention, 0, false);
       }
-      writer_.closeFile();
     } catch (netCDF::exceptions::NcException& exception) {
       Monio::get().closeFiles();
       std::string exceptionMessage = exception.what();
@@ -241,39 +274,17 @@ void monio::Monio::writeState(const atlas::FieldSet& localFieldSet,
       if (isLfricConvention == false) {
         addJediData(fileData);
       }
-      writer_.openFile(filePath);
-      for (const auto& fieldMetadata : fieldMetadataVec) {
-        auto& localField = localFieldSet[fieldMetadata.jediName];
-        atlas::Field globalField = utilsatlas::getGlobalField(localField);
-        if (mpiCommunicator_.rank() == mpiRankOwner_) {
-          // Configure write name
-          std::string writeName;
-          std::string verticalConfigName;
-          if (isLfricConvention == true) {
-            writeName = fieldMetadata.lfricReadName;
-            verticalConfigName = fieldMetadata.lfricVertConfig;
-          } else if (isLfricConvention == false && fieldMetadata.jediName == globalField.name()) {
-            writeName = fieldMetadata.jediName;
-            verticalConfigName = fieldMetadata.jediVertConfig;
-          } else {
-            Monio::get().closeFiles();
-            utils::throwException("Monio::writeState()> Field metadata configuration error...");
-          }
-          oops::Log::trace() << "Monio::writeState() processing data for> \"" <<
-                                  writeName << "\"..." << std::endl;
-
-          atlasWriter_.populateFileDataWithField(fileData,
-                                                 globalField,
-                                                 fieldMetadata,
-                                                 writeName,
-                                                 verticalConfigName,
-                                                 isLfricConvention);
-          writer_.writeMetadata(fileData.getMetadata());
-          writer_.writeData(fileData);
-          fileData.clearData();  // Written and globalised field data no longer required
-        }
+      // All variables are defined before any field is gathered, so that the file is defined once
+      std::vector<std::string> writeNames = defineFields(localFieldSet, fieldMetadataVec, fileData,
+                                                         isLfricConvention, false);
+      if (isParallelWrite_ == true) {
+        writeBehind_.wait();
+        writeFieldsInParallel(localFieldSet, fieldMetadataVec, writeNames, filePath, fileData,
+                              isLfricConvention);
+      } else {
+        writeFieldsInSerial(localFieldSet, fieldMetadataVec, writeNames, filePath, fileData,
+                            isLfricConvention, 0, false);
       }
-      writer_.closeFile();
     } catch (netCDF::exceptions::NcException& exception) {
       Monio::get().closeFiles();
       std::string exceptionMessage = exception.what();
@@ -285,6 +296,48 @@ void monio::Monio::writeState(const atlas::FieldSet& localFieldSet,
   }
 }
 
+void monio::Monio::appendState(const atlas::FieldSet& localFieldSet,
+                               const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                               const std::string& filePath,
+                               const util::DateTime& dateTime,
+                               const bool isFirstState,
+                               const bool isLfricConvention) {
+  oops::Log::trace() << "Monio::appendState()" << std::endl;
+  if (localFieldSet.size() == 0) {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::appendState()> localFieldSet has zero fields...");
+  }
+  if (filePath.length() != 0) {
+    try {
+      auto& functionSpace = localFieldSet[0].functionspace();
+      auto& grid = atlas::functionspace::NodeColumns(functionSpace).mesh().grid();
+      FileData fileData = getFileData(grid.name());
+      cleanFileData(fileData);  // Remove metadata required for reading, but not for writing.
+      if (isLfricConvention == false) {
+        addJediData(fileData);
+      }
+      std::vector<std::string> writeNames = defineFields(localFieldSet, fieldMetadataVec, fileData,
+                                                         isLfricConvention, false);
+      writeBehind_.wait();  // The file appended to may be queued for writing
+      // Only the owning PE opens the file, so requires the time step
+      std::size_t timeStep = 0;
+      if (mpiCommunicator_.rank() == mpiRankOwner_) {
+        timeStep = defineTimeSeries(fileData, writeNames, filePath, dateTime, isFirstState);
+      }
+      writeFieldsInSerial(localFieldSet, fieldMetadataVec, writeNames, filePath, fileData,
+                          isLfricConvention, timeStep, true);
+    } catch (netCDF::exceptions::NcException& exception) {
+      Monio::get().closeFiles();
+      std::string exceptionMessage = exception.what();
+      utils::throwException("Monio::appendState()> An exception has occurred: " +
+                            exceptionMessage);
+    }
+  } else {
+    oops::Log::info() << "Monio::appendState()> No file path supplied. "
+                         "NetCDF writing will not take place..." << std::endl;
+  }
+}
+
 void monio::Monio::writeFieldSet(const atlas::FieldSet& localFieldSet,
                                  const std::string& filePath) {
   oops::Log::trace() << "Monio::writeFieldSet()" << std::endl;
@@ -295,16 +348,22 @@ void monio::Monio::writeFieldSet(const atlas::FieldSet& localFieldSet,
   if (filePath.length() != 0) {
     try {
       FileData fileData;  // Object needs to persist across fields for correct metadata creation
-      writer_.openFile(filePath);
+      std::vector<atlas::Field> localFields;
       for (const auto& localField : localFieldSet) {
-        atlas::Field globalField = utilsatlas::getGlobalField(localField);
+        localFields.push_back(localField);
+      }
+      // All fields are gathered before writing, so that the file is defined in a single pass
+      fieldGatherer_.start(localFields);
+      for (std::size_t i = 0; i < localFields.size(); ++i) {
+        atlas::Field globalField = fieldGatherer_.next();
         if (mpiCommunicator_.rank() == mpiRankOwner_) {
           atlasWriter_.populateFileDataWithField(fileData, globalField, globalField.name());
-          writer_.writeMetadata(fileData.getMetadata());
-          writer_.writeData(fileData);
-          fileData.clearData();  // Written and globalised field data no longer required
         }
       }
+      writeBehind_.wait();
+      writer_.openFile(filePath);
+      writer_.writeMetadata(fileData.getMetadata());
+      writer_.writeData(fileData);
       writer_.closeFile();
     } catch (netCDF::exceptions::NcException& exception) {
       Monio::get().closeFiles();
@@ -319,18 +378,147 @@ void monio::Monio::writeFieldSet(const atlas::FieldSet& localFieldSet,
 
 void monio::Monio::closeFiles() {
   oops::Log::trace() << "Monio::closeFiles()" << std::endl;
+  // Files in use by the main thread are not closed by background threads, such as the I/O and
+  // write threads. Their errors are rethrown on the main thread, which then closes them.
+  if (utils::isBackgroundThread() == true) {
+    return;
+  }
+  // Files are not closed whilst the I/O thread may be reading them
+  readPipeline_.finish();
+  // Or whilst files queued for writing remain unwritten
+  writeBehind_.wait();
   if (reader_.isOpen() == true) {
     reader_.closeFile();
   }
+  if (ioReader_ != nullptr && ioReader_->isOpen() == true) {
+    ioReader_->closeFile();
+  }
   if (writer_.isOpen() == true) {
     writer_.closeFile();
   }
+  // parallelReader_ and parallelWriter_ are not closed here. Closure is collective and this may be
+  // called by one PE.
+}
+
+void monio::Monio::setMapCacheDirectory(const std::string& cacheDirPath) {
+  oops::Log::trace() << "Monio::setMapCacheDirectory()" << std::endl;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    mapCache_.setCacheDirectory(cacheDirPath);
+  }
+}
+
+void monio::Monio::warmMapCache(const std::map<std::string, std::string>& gridFilePaths) {
+  oops::Log::trace() << "Monio::warmMapCache()" << std::endl;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    for (const auto& gridFilePathPair : gridFilePaths) {
+      const std::string& filePath = gridFilePathPair.second;
+      if (utils::fileExists(filePath) == false) {
+        Monio::get().closeFiles();
+        utils::throwException("Monio::warmMapCache()> File \"" + filePath + "\" does not exist...");
+      }
+      // NetCDF access remains on this thread. Only creation of the map is run in the background.
+      FileData fileData;
+      Reader reader(mpiCommunicator_, mpiRankOwner_, filePath);
+      reader.readMetadata(fileData);
+      reader.readFullData(fileData, consts::kLfricCoordVarNames);
+      reader.closeFile();
+      std::vector<std::shared_ptr<monio::DataContainerBase>> coordData =
+                                  reader.getCoordData(fileData, consts::kLfricCoordVarNames);
+      std::vector<atlas::PointLonLat> lfricCoords = utilsatlas::getLfricCoords(coordData);
+      atlas::CubedSphereGrid grid(gridFilePathPair.first);
+      std::vector<atlas::PointLonLat> atlasCoords = utilsatlas::getAtlasCoords(grid);
+      if (atlasCoords.size() != lfricCoords.size()) {
+        Monio::get().closeFiles();
+        utils::throwException("Monio::warmMapCache()> Grid \"" + grid.name() +
+                              "\" is not compatible with file \"" + filePath + "\"...");
+      }
+      std::string key = mapCache_.createKey(grid.name(), lfricCoords);
+      std::vector<uint32_t> lfricAtlasMap;
+      if (mapCache_.findMap(key, lfricAtlasMap) == false) {
+        mapCache_.warmMap(key, std::move(atlasCoords), std::move(lfricCoords));
+      }
+    }
+  }
+}
+
+void monio::Monio::setIORanks(const std::vector<int>& ioRanks) {
+  oops::Log::trace() << "Monio::setIORanks()" << std::endl;
+  std::vector<std::size_t> newIORanks = {mpiRankOwner_};
+  for (const auto& ioRank : ioRanks) {
+    if (ioRank < 0 || static_cast<std::size_t>(ioRank) >= mpiCommunicator_.size()) {
+      Monio::get().closeFiles();
+      utils::throwException("Monio::setIORanks()> I/O rank " + std::to_string(ioRank) +
+                            " is outside of the communicator...");
+    }
+    if (utils::findInVector(newIORanks, static_cast<std::size_t>(ioRank)) == false) {
+      newIORanks.push_back(ioRank);
+    }
+  }
+  ioRanks_ = newIORanks;
+  ioReader_.reset();
+  if (isIORank() == true && mpiCommunicator_.rank() != mpiRankOwner_) {
+    ioReader_ = std::make_unique<Reader>(mpiCommunicator_, mpiCommunicator_.rank());
+  }
+}
+
+void monio::Monio::setParallelRead(const bool isParallelRead) {
+  oops::Log::trace() << "Monio::setParallelRead()" << std::endl;
+  isParallelRead_ = isParallelRead;
+}
+
+void monio::Monio::setParallelWrite(const bool isParallelWrite) {
+  oops::Log::trace() << "Monio::setParallelWrite()" << std::endl;
+  isParallelWrite_ = isParallelWrite;
+}
+
+void monio::Monio::setAsyncWrite(const bool isAsyncWrite) {
+  oops::Log::trace() << "Monio::setAsyncWrite()" << std::endl;
+  isAsyncWrite_ = isAsyncWrite;
+}
+
+void monio::Monio::waitForWrites() {
+  oops::Log::trace() << "Monio::waitForWrites()" << std::endl;
+  writeBehind_.wait();
+}
+
+void monio::Monio::setStorageOptions(const consts::StorageOptions& storageOptions) {
+  oops::Log::trace() << "Monio::setStorageOptions()" << std::endl;
+  validateStorageOptions(storageOptions);
+  storageOptions_ = storageOptions;
+}
+
+void monio::Monio::setStorageOptions(const std::string& jediName,
+                                     const consts::StorageOptions& storageOptions) {
+  oops::Log::trace() << "Monio::setStorageOptions()" << std::endl;
+  validateStorageOptions(storageOptions);
+  fieldStorageOptions_[jediName] = storageOptions;
+}
+
+void monio::Monio::clearStorageOptions(const std::string& jediName) {
+  oops::Log::trace() << "Monio::clearStorageOptions()" << std::endl;
+  fieldStorageOptions_.erase(jediName);
+}
+
+void monio::Monio::setReadBufferCount(const std::size_t numBuffers) {
+  oops::Log::trace() << "Monio::setReadBufferCount()" << std::endl;
+  numReadBuffers_ = numBuffers;
+}
+
+void monio::Monio::setReadBlockLevels(const std::size_t numLevels) {
+  oops::Log::trace() << "Monio::setReadBlockLevels()" << std::endl;
+  readBlockLevels_ = numLevels;
+}
+
+void monio::Monio::setWriteBlockLevels(const std::size_t numLevels) {
+  oops::Log::trace() << "Monio::setWriteBlockLevels()" << std::endl;
+  writeBlockLevels_ = numLevels;
 }
 
 int monio::Monio::initialiseFile(const atlas::Grid& grid,
                                  const std::string& filePath,
                                  bool doCreateDateTimes) {
   oops::Log::trace() << "Monio::initialiseFile()" << std::endl;
+  writeBehind_.wait();  // The file read may be one queued for writing
   int variableConvention = consts::eLfricConvention;  // LFRic convention is default
   if (mpiCommunicator_.rank() == mpiRankOwner_) {
     FileData& fileData = createFileData(grid.name(), filePath);
@@ -344,6 +532,7 @@ int monio::Monio::initialiseFile(const atlas::Grid& grid,
     reader_.readFullDatum(fileData, std::string(consts::kVerticalHalfName));
     // Process read data
     createLfricAtlasMap(fileData, grid);
+    shareLfricAtlasMap(fileData);
     if (doCreateDateTimes == true) {
       reader_.readFullDatum(fileData, std::string(consts::kTimeVarName));
       createDateTimes(fileData,
@@ -351,6 +540,19 @@ int monio::Monio::initialiseFile(const atlas::Grid& grid,
                       std::string(consts::kTimeOriginName));
     }
     variableConvention = fileData.getMetadata().getVariableConvention();
+  } else if (isIORank() == true) {
+    // Other I/O ranks open the file themselves, but only read what is needed to read fields.
+    FileData& fileData = createFileData(grid.name(), filePath);
+    ioReader_->openFile(filePath);
+    ioReader_->readMetadata(fileData);
+    shareLfricAtlasMap(fileData);
+    if (doCreateDateTimes == true) {
+      ioReader_->readFullDatum(fileData, std::string(consts::kTimeVarName));
+      createDateTimes(fileData,
+                      std::string(consts::kTimeVarName),
+                      std::string(consts::kTimeOriginName));
+    }
+    variableConvention = fileData.getMetadata().getVariableConvention();
   }
   return variableConvention;
 }
@@ -363,11 +565,82 @@ monio::Monio::Monio(const eckit::mpi::Comm& mpiCommunicator,
       mpiRankOwner_(mpiRankOwner),
       reader_(mpiCommunicator, mpiRankOwner_),
       writer_(mpiCommunicator, mpiRankOwner_),
-      atlasReader_(mpiCommunicator, mpiRankOwner_),
-      atlasWriter_(mpiCommunicator, mpiRankOwner_) {
+      atlasWriter_(mpiCommunicator, mpiRankOwner_),
+      fieldGatherer_(mpiCommunicator, mpiRankOwner_),
+      fieldScatterer_(mpiCommunicator, mpiRankOwner_),
+      ioRanks_({mpiRankOwner_}),
+      numReadBuffers_(consts::kReadBufferCount),
+      readBlockLevels_(0),
+      writeBlockLevels_(0),
+      parallelReader_(mpiCommunicator),
+      isParallelRead_(false),
+      parallelWriter_(mpiCommunicator),
+      isParallelWrite_(false),
+      writeBehind_(mpiCommunicator, mpiRankOwner_),
+      isAsyncWrite_(false) {
   oops::Log::trace() << "Monio::Monio()" << std::endl;
 }
 
+bool monio::Monio::isIORank() {
+  return utils::findInVector(ioRanks_, mpiCommunicator_.rank());
+}
+
+void monio::Monio::validateStorageOptions(const consts::StorageOptions& storageOptions) {
+  oops::Log::trace() << "Monio::validateStorageOptions()" << std::endl;
+  if (storageOptions.quantisation != consts::eNoQuantisation) {
+    const int maxPrecision = storageOptions.quantisation == consts::eBitRound ?
+                             consts::kMaxQuantisationBits : consts::kMaxQuantisationDigits;
+    if (storageOptions.quantisationPrecision < 1 ||
+        storageOptions.quantisationPrecision > maxPrecision) {
+      Monio::get().closeFiles();
+      utils::throwException("Monio::validateStorageOptions()> Quantisation precision of " +
+                            std::to_string(storageOptions.quantisationPrecision) +
+                            " is outside the range of 1 to " + std::to_string(maxPrecision) +
+                            "...");
+    }
+  }
+}
+
+monio::Reader& monio::Monio::getReader() {
+  if (ioReader_ != nullptr) {
+    return *ioReader_;
+  }
+  return reader_;
+}
+
+std::vector<std::size_t> monio::Monio::assignFieldsToIORanks(const atlas::FieldSet& localFieldSet,
+                                    const std::vector<consts::FieldMetadata>& fieldMetadataVec) {
+  oops::Log::trace() << "Monio::assignFieldsToIORanks()" << std::endl;
+  // Sizes are derived from the grid and levels so that all PEs reach the same assignment.
+  std::vector<std::pair<std::size_t, std::size_t>> fieldSizes;  // Size and field index
+  for (std::size_t index = 0; index < fieldMetadataVec.size(); ++index) {
+    const atlas::Field& localField = localFieldSet[fieldMetadataVec[index].jediName];
+    const atlas::Grid& grid =
+        atlas::functionspace::NodeColumns(localField.functionspace()).mesh().grid();
+    std::size_t fieldSize = grid.size() * localField.shape(consts::eVertical) *
+                            localField.datatype().size();
+    fieldSizes.push_back({fieldSize, index});
+  }
+  // Largest first, each to the least-loaded I/O rank. Ties are resolved by index and rank order.
+  std::stable_sort(fieldSizes.begin(), fieldSizes.end(),
+                   [](const auto& a, const auto& b) { return a.first > b.first; });
+  std::vector<std::size_t> ioRankLoads(ioRanks_.size(), 0);
+  std::vector<std::vector<std::size_t>> ioRankFields(ioRanks_.size());
+  for (const auto& fieldSizePair : fieldSizes) {
+    auto minIt = std::min_element(ioRankLoads.begin(), ioRankLoads.end());
+    std::size_t ioRankIndex = std::distance(ioRankLoads.begin(), minIt);
+    *minIt += fieldSizePair.first;
+    ioRankFields[ioRankIndex].push_back(fieldSizePair.second);
+  }
+  std::vector<std::size_t> sourceRanks(fieldMetadataVec.size());
+  for (std::size_t ioRankIndex = 0; ioRankIndex < ioRanks_.size(); ++ioRankIndex) {
+    for (const auto& fieldIndex : ioRankFields[ioRankIndex]) {
+      sourceRanks[fieldIndex] = ioRanks_[ioRankIndex];
+    }
+  }
+  return sourceRanks;
+}
+
 monio::FileData& monio::Monio::createFileData(const std::string& gridName,
                                               const std::string& filePath) {
   oops::Log::trace() << "Monio::createFileData()" << std::endl;
@@ -381,6 +654,351 @@ monio::FileData& monio::Monio::createFileData(const std::string& gridName,
   return filesData_.at(gridName);
 }
 
+monio::FileData& monio::Monio::getStoredFileData(const std::string& gridName) {
+  oops::Log::trace() << "Monio::getStoredFileData()" << std::endl;
+  auto it = filesData_.find(gridName);
+  if (it == filesData_.end()) {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::getStoredFileData()> No file data for grid \"" + gridName +
+                          "\". File has not been initialised...");
+  }
+  return it->second;
+}
+
+monio::consts::LevelRemap monio::Monio::getReadLevelRemap(
+                                const consts::FieldMetadata& fieldMetadata,
+                                const std::size_t numLevels,
+                                const int variableConvention) {
+  oops::Log::trace() << "Monio::getReadLevelRemap()" << std::endl;
+  consts::LevelRemap levelRemap;
+  if (fieldMetadata.readLevelStart >= 0) {
+    levelRemap.levelOffset = fieldMetadata.readLevelStart;
+    return levelRemap;
+  }
+  // Erroneous case. For noFirstLevel == true field should have 70 levels
+  if (fieldMetadata.noFirstLevel == true && numLevels == consts::kVerticalFullSize) {
+    Monio::get().closeFiles();
+    utils::throwException("Monio::getReadLevelRemap()> Field levels misconfiguration...");
+  }
+  // The zeroth level in the file is skipped for LFRic fields without a first level
+  return utils::getLevelRemap(variableConvention == consts::eLfricConvention,
+                              fieldMetadata.noFirstLevel, numLevels);
+}
+
+void monio::Monio::readFieldsInSerial(std::vector<atlas::FieldSet>& localFieldSets,
+                                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                const std::vector<std::size_t>& sourceRanks,
+                                const std::vector<std::size_t>& readIndices,
+                                const std::vector<std::string>& readNames,
+                                const std::vector<bool>& isFieldRead,
+                                const std::string& gridName,
+                                const int variableConvention,
+                                const std::size_t timeStep) {
+  oops::Log::trace() << "Monio::readFieldsInSerial()" << std::endl;
+  // Fields read at more than one time are read whole, so that their blocks are taken in the order
+  // they are read.
+  const std::size_t numTimes = localFieldSets.size();
+  const std::size_t blockLevels = numTimes == 1 ? readBlockLevels_ : 0;
+  // Fields are scattered by field, then by time
+  std::vector<atlas::Field> localFields;
+  std::vector<std::size_t> fieldSourceRanks;
+  std::vector<std::size_t> fieldIndices;
+  std::vector<consts::LevelRemap> levelRemaps;
+  std::vector<atlas::FieldSet> readFieldSets(numTimes);
+  for (std::size_t i = 0; i < fieldMetadataVec.size(); ++i) {
+    if (isFieldRead[i] == true) {
+      const consts::FieldMetadata& fieldMetadata = fieldMetadataVec[i];
+      const consts::LevelRemap levelRemap = getReadLevelRemap(fieldMetadata,
+          localFieldSets[0][fieldMetadata.jediName].shape(consts::eVertical), variableConvention);
+      for (std::size_t time = 0; time < numTimes; ++time) {
+        auto& localField = localFieldSets[time][fieldMetadata.jediName];
+        localFields.push_back(localField);
+        fieldSourceRanks.push_back(sourceRanks[i]);
+        fieldIndices.push_back(i);
+        levelRemaps.push_back(levelRemap);
+        readFieldSets[time].add(localField);
+      }
+    }
+  }
+  // Blocks of file levels are read in the order they are scattered: by field, then by level. Only
+  // the file levels of each field are read, where fields hold fewer levels than their variables.
+  // Each block is read at all times with one hyperslab.
+  std::vector<consts::LevelBlock> readBlocks;
+  for (const auto& i : readIndices) {
+    const consts::FieldMetadata& fieldMetadata = fieldMetadataVec[i];
+    const std::size_t numLevels =
+        localFieldSets[0][fieldMetadata.jediName].shape(consts::eVertical);
+    const consts::LevelRemap levelRemap = getReadLevelRemap(fieldMetadata, numLevels,
+                                                            variableConvention);
+    const std::size_t maxBlockLevels = blockLevels != 0 ? blockLevels : numLevels;
+    for (std::size_t levelStart = 0; levelStart < numLevels; levelStart += maxBlockLevels) {
+      readBlocks.push_back({i, levelStart + levelRemap.levelOffset,
+                            std::min(maxBlockLevels, numLevels - levelStart)});
+    }
+  }
+  // Reads are keyed by block, then by time
+  std::vector<std::size_t> readKeys(readBlocks.size() * numTimes);
+  for (std::size_t i = 0; i < readKeys.size(); ++i) {
+    readKeys[i] = i;
+  }
+  // Called on the I/O thread, where blocks are read ahead of distribution. The data of a block at
+  // each time are held until taken.
+  std::vector<std::shared_ptr<DataContainerBase>> timeContainers;
+  auto readKeyBlock = [&](const std::size_t readKey) {
+    const std::size_t time = readKey % numTimes;
+    if (time == 0) {
+      const consts::LevelBlock& readBlock = readBlocks[readKey / numTimes];
+      timeContainers = getReader().readDatumLevels(getStoredFileData(gridName),
+                                                   readNames[readBlock.fieldIndex], timeStep,
+                                                   numTimes, std::string(consts::kTimeDimName),
+                                                   readBlock.levelStart, readBlock.numLevels);
+    }
+    return std::move(timeContainers[time]);
+  };
+  // The LFRic-Atlas map is held on I/O ranks only
+  std::vector<uint32_t> noLfricAtlasMap;
+  std::vector<uint32_t>& lfricAtlasMap = isIORank() == true ?
+      getStoredFileData(gridName).getLfricAtlasMap() : noLfricAtlasMap;
+  fieldScatterer_.createPlan(localFieldSets[0][0], ioRanks_, lfricAtlasMap);
+  readPipeline_.start(readKeys, readKeyBlock, numReadBuffers_);
+  std::size_t numTaken = 0;
+  fieldScatterer_.scatter(localFields, fieldSourceRanks,
+                          [&](const std::size_t i, const std::size_t levelStart,
+                              const std::size_t numLevels) {
+                            const std::size_t blockIndex = numTaken / numTimes;
+                            if (blockIndex >= readBlocks.size() ||
+                                readBlocks[blockIndex].fieldIndex != fieldIndices[i] ||
+                                readBlocks[blockIndex].levelStart != levelStart ||
+                                readBlocks[blockIndex].numLevels != numLevels ||
+                                numTaken % numTimes != i % numTimes) {
+                              readPipeline_.finish();
+                              Monio::get().closeFiles();
+                              utils::throwException("Monio::readFieldsInSerial()> Block of "
+                                                    "field \"" + localFields[i].name() +
+                                                    "\" not read...");
+                            }
+                            return readPipeline_.take(numTaken++);
+                          }, levelRemaps, blockLevels);
+  readPipeline_.finish();
+  for (auto& readFieldSet : readFieldSets) {
+    readFieldSet.haloExchange();
+  }
+}
+
+void monio::Monio::readFieldsInParallel(std::vector<atlas::FieldSet>& localFieldSets,
+                                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                const std::string& filePath,
+                                const std::string& gridName,
+                                int variableConvention,
+                                std::vector<std::size_t> timeSteps) {
+  oops::Log::trace() << "Monio::readFieldsInParallel()" << std::endl;
+  // All PEs require the LFRic-Atlas map to locate their columns in the file.
+  std::vector<uint32_t> lfricAtlasMap;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    lfricAtlasMap = getStoredFileData(gridName).getLfricAtlasMap();
+  }
+  std::size_t mapSize = lfricAtlasMap.size();
+  mpiCommunicator_.broadcast(mapSize, mpiRankOwner_);
+  lfricAtlasMap.resize(mapSize);
+  mpiCommunicator_.broadcast(lfricAtlasMap, mpiRankOwner_);
+  mpiCommunicator_.broadcast(variableConvention, mpiRankOwner_);
+  mpiCommunicator_.broadcast(timeSteps, mpiRankOwner_);
+
+  // The file and read plan are shared by all time steps. Only fields are read at each.
+  parallelReader_.openFile(filePath);
+  parallelReader_.createReadPlan(localFieldSets[0][0], lfricAtlasMap);
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    // Configure read name
+    std::string readName = fieldMetadata.lfricReadName;
+    if (variableConvention == consts::eJediConvention) {
+      readName = fieldMetadata.jediName;
+    }
+    if (utils::findInVector(consts::kMissingVariableNames, readName) == false) {
+      oops::Log::trace() << "Monio::readFieldsInParallel() processing data for> \"" <<
+                            readName << "\"..." << std::endl;
+      const consts::LevelRemap levelRemap = getReadLevelRemap(fieldMetadata,
+          localFieldSets[0][fieldMetadata.jediName].shape(consts::eVertical), variableConvention);
+      for (std::size_t i = 0; i < localFieldSets.size(); ++i) {
+        auto& localField = localFieldSets[i][fieldMetadata.jediName];
+        parallelReader_.readField(localField, readName, timeSteps[i], levelRemap.levelOffset);
+        localField.haloExchange();
+      }
+    } else {
+      oops::Log::info() << "Monio::readFieldsInParallel()> Variable \"" + fieldMetadata.jediName +
+                           "\" not defined in LFRic. Skipping read..." << std::endl;
+    }
+  }
+  parallelReader_.closeFile();
+}
+
+std::vector<std::string> monio::Monio::defineFields(const atlas::FieldSet& localFieldSet,
+                                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                FileData& fileData,
+                                const bool isLfricConvention,
+                                const bool isIncrement) {
+  oops::Log::trace() << "Monio::defineFields()" << std::endl;
+  // Metadata are only created on the owning PE. Write names are returned on all PEs.
+  std::vector<std::string> writeNames;
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    const auto& localField = localFieldSet[fieldMetadata.jediName];
+    // Configure write name
+    std::string writeName;
+    std::string verticalConfigName;
+    if (isLfricConvention == true) {
+      writeName = isIncrement == true ? fieldMetadata.lfricWriteName :
+                                        fieldMetadata.lfricReadName;
+      verticalConfigName = fieldMetadata.lfricVertConfig;
+    } else if (isLfricConvention == false && fieldMetadata.jediName == localField.name()) {
+      writeName = fieldMetadata.jediName;
+      verticalConfigName = fieldMetadata.jediVertConfig;
+    } else {
+      Monio::get().closeFiles();
+      utils::throwException("Monio::defineFields()> Field metadata configuration error...");
+    }
+    oops::Log::trace() << "Monio::defineFields() processing metadata for> \"" <<
+                          writeName << "\"..." << std::endl;
+    atlasWriter_.populateMetadataWithDistributedField(fileData,
+                                                      localField,
+                                                      fieldMetadata,
+                                                      writeName,
+                                                      verticalConfigName,
+                                                      isLfricConvention);
+    if (mpiCommunicator_.rank() == mpiRankOwner_) {
+      auto it = fieldStorageOptions_.find(fieldMetadata.jediName);
+      fileData.getMetadata().getVariable(writeName)->setStorageOptions(
+          it != fieldStorageOptions_.end() ? it->second : storageOptions_);
+    }
+    // Packing attributes are derived from the range of the field across all PEs
+    if (fieldMetadata.outputType == consts::eShort || fieldMetadata.outputType == consts::eByte) {
+      std::pair<double, double> fieldRange = utilsatlas::getFieldRange(localField,
+                                                                       mpiCommunicator_);
+      atlasWriter_.addPackingAttributes(fileData, writeName, fieldMetadata.outputType,
+                                        fieldRange.first, fieldRange.second);
+    }
+    writeNames.push_back(writeName);
+  }
+  return writeNames;
+}
+
+void monio::Monio::writeFieldsInSerial(const atlas::FieldSet& localFieldSet,
+                                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                const std::vector<std::string>& writeNames,
+                                const std::string& filePath,
+                                FileData& fileData,
+                                const bool isLfricConvention,
+                                const std::size_t timeStep,
+                                const bool isAppend) {
+  oops::Log::trace() << "Monio::writeFieldsInSerial()" << std::endl;
+  std::vector<atlas::Field> localFields;
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    localFields.push_back(localFieldSet[fieldMetadata.jediName]);
+  }
+  // Asynchronous writes hold the data of all fields, so are not made in blocks. Appends are not
+  // asynchronous, as the time step written depends on those before.
+  const bool isAsyncWrite = isAsyncWrite_ == true && isAppend == false;
+  const std::size_t blockLevels = isAsyncWrite == true ? 0 : writeBlockLevels_;
+  fieldGatherer_.start(localFields, blockLevels);
+  if (isAsyncWrite == false) {
+    writeBehind_.wait();  // Files are not written from two threads at once
+    // The date-time of an appended state is written at its time step, apart from mesh data
+    std::shared_ptr<DataContainerBase> timeContainer = nullptr;
+    if (isAppend == true && mpiCommunicator_.rank() == mpiRankOwner_) {
+      timeContainer = fileData.getData().getContainer(std::string(consts::kTimeVarName));
+      fileData.getData().deleteContainer(std::string(consts::kTimeVarName));
+    }
+    // Files appended to already hold their metadata and mesh data
+    if (isAppend == true && timeStep != 0) {
+      writer_.openFile(filePath, netCDF::NcFile::write);
+    } else {
+      writer_.openFile(filePath);
+      writer_.writeMetadata(fileData.getMetadata());
+      writer_.writeData(fileData);  // Mesh data
+    }
+    if (timeContainer != nullptr) {
+      writer_.writeDatumLevels(fileData.getMetadata(), timeContainer, timeStep,
+                               std::string(consts::kTimeDimName), 0, 1);
+    }
+    fileData.getData().clear();
+  }
+  // Received columns are placed straight into a container in LFRic order, which is reused for each
+  // block where blocks are written in turn. Asynchronous writes hold the data of all fields.
+  std::shared_ptr<DataContainerBase> dataContainer = nullptr;
+  for (std::size_t i = 0; i < fieldMetadataVec.size(); ++i) {
+    oops::Log::trace() << "Monio::writeFieldsInSerial() processing data for> \"" <<
+                          writeNames[i] << "\"..." << std::endl;
+    const atlas::Field& localField = localFields[i];
+    const std::size_t numLevels = localField.shape(consts::eVertical);
+    // The surface level is written twice for LFRic fields without a first level
+    const consts::LevelRemap levelRemap = utils::getLevelRemap(isLfricConvention,
+                                              fieldMetadataVec[i].noFirstLevel, numLevels);
+    // Packed data are held at the type of the field and packed as they are written
+    int containerType = utilsatlas::atlasTypeToMonioEnum(localField.datatype());
+    if (mpiCommunicator_.rank() == mpiRankOwner_) {
+      const int writeType = fileData.getMetadata().getVariable(writeNames[i])->getType();
+      if (writeType != consts::eShort && writeType != consts::eByte) {
+        containerType = writeType;
+      }
+    }
+    const std::size_t numBlocks = blockLevels == 0 ? 1 :
+                                  (numLevels + blockLevels - 1) / blockLevels;
+    for (std::size_t block = 0; block < numBlocks; ++block) {
+      if (isAsyncWrite == true) {
+        dataContainer = nullptr;
+      }
+      consts::LevelBlock fileBlock = fieldGatherer_.next(dataContainer, writeNames[i],
+                                                         containerType,
+                                                         fileData.getLfricAtlasMap(), levelRemap);
+      if (mpiCommunicator_.rank() == mpiRankOwner_) {
+        if (isAsyncWrite == true) {
+          fileData.getData().addContainer(dataContainer);
+        } else {
+          writer_.writeDatumLevels(fileData.getMetadata(), dataContainer, timeStep,
+                                   std::string(consts::kTimeDimName), fileBlock.levelStart,
+                                   fileBlock.numLevels);
+        }
+      }
+    }
+  }
+  if (isAsyncWrite == true) {
+    if (mpiCommunicator_.rank() == mpiRankOwner_) {
+      writeBehind_.push(std::move(fileData), filePath);
+    }
+  } else {
+    writer_.closeFile();
+  }
+}
+
+void monio::Monio::writeFieldsInParallel(const atlas::FieldSet& localFieldSet,
+                                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                const std::vector<std::string>& writeNames,
+                                const std::string& filePath,
+                                FileData& fileData,
+                                const bool isLfricConvention) {
+  oops::Log::trace() << "Monio::writeFieldsInParallel()" << std::endl;
+  // The file is created, and mesh data written, by the owning PE before it is opened by all PEs.
+  writer_.openFile(filePath);
+  writer_.writeMetadata(fileData.getMetadata());
+  writer_.writeData(fileData);
+  writer_.closeFile();
+  mpiCommunicator_.barrier();
+
+  // All PEs require the LFRic-Atlas map to locate their columns in the file.
+  std::vector<uint32_t> lfricAtlasMap = fileData.getLfricAtlasMap();
+  std::size_t mapSize = lfricAtlasMap.size();
+  mpiCommunicator_.broadcast(mapSize, mpiRankOwner_);
+  lfricAtlasMap.resize(mapSize);
+  mpiCommunicator_.broadcast(lfricAtlasMap, mpiRankOwner_);
+
+  parallelWriter_.openFile(filePath);
+  parallelWriter_.createWritePlan(localFieldSet[0], lfricAtlasMap);
+  for (std::size_t i = 0; i < fieldMetadataVec.size(); ++i) {
+    const auto& localField = localFieldSet[fieldMetadataVec[i].jediName];
+    parallelWriter_.writeField(localField, writeNames[i], fieldMetadataVec[i].noFirstLevel,
+                               isLfricConvention);
+  }
+  parallelWriter_.closeFile();
+}
+
 monio::FileData monio::Monio::getFileData(const std::string& gridName) {
   oops::Log::trace() << "Monio::getFileData()" << std::endl;
   auto it = filesData_.find(gridName);
@@ -398,17 +1016,43 @@ void monio::Monio::createLfricAtlasMap(FileData& fileData, const atlas::CubedSph
       std::vector<std::shared_ptr<monio::DataContainerBase>> coordData =
                                 reader_.getCoordData(fileData, consts::kLfricCoordVarNames);
       std::vector<atlas::PointLonLat> lfricCoords = utilsatlas::getLfricCoords(coordData);
-      std::vector<atlas::PointLonLat> atlasCoords = utilsatlas::getAtlasCoords(grid);
-      fileData.setLfricAtlasMap(utilsatlas::createLfricAtlasMap(atlasCoords, lfricCoords));
+      std::string key = mapCache_.createKey(grid.name(), lfricCoords);
+      std::vector<uint32_t> lfricAtlasMap;
+      if (mapCache_.findMap(key, lfricAtlasMap) == false) {
+        std::vector<atlas::PointLonLat> atlasCoords = utilsatlas::getAtlasCoords(grid);
+        lfricAtlasMap = utilsatlas::createLfricAtlasMap(atlasCoords, lfricCoords);
+        mapCache_.storeMap(key, lfricAtlasMap);
+      }
+      fileData.setLfricAtlasMap(std::move(lfricAtlasMap));
     }
   }
 }
 
+void monio::Monio::shareLfricAtlasMap(FileData& fileData) {
+  oops::Log::trace() << "Monio::shareLfricAtlasMap()" << std::endl;
+  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    const std::vector<uint32_t>& lfricAtlasMap = fileData.getLfricAtlasMap();
+    std::size_t mapSize = lfricAtlasMap.size();
+    for (const auto& ioRank : ioRanks_) {
+      if (ioRank != mpiRankOwner_) {
+        mpiCommunicator_.send(&mapSize, 1, ioRank, consts::kMapMessageTag);
+        mpiCommunicator_.send(lfricAtlasMap.data(), mapSize, ioRank, consts::kMapMessageTag);
+      }
+    }
+  } else if (isIORank() == true) {
+    std::size_t mapSize = 0;
+    mpiCommunicator_.receive(&mapSize, 1, mpiRankOwner_, consts::kMapMessageTag);
+    std::vector<uint32_t> lfricAtlasMap(mapSize);
+    mpiCommunicator_.receive(lfricAtlasMap.data(), mapSize, mpiRankOwner_, consts::kMapMessageTag);
+    fileData.setLfricAtlasMap(std::move(lfricAtlasMap));
+  }
+}
+
 void monio::Monio::createDateTimes(FileData& fileData,
                              const std::string& timeVarName,
                              const std::string& timeOriginName) {
   oops::Log::trace() << "Monio::createDateTimes()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (isIORank() == true) {
     if (fileData.getDateTimes().size() == 0) {
       std::shared_ptr<Variable> timeVar = fileData.getMetadata().getVariable(timeVarName);
       std::shared_ptr<DataContainerBase> timeDataBase =
@@ -460,6 +1104,108 @@ void monio::Monio::cleanFileData(FileData& fileData) {
   }
 }
 
+std::size_t monio::Monio::defineTimeSeries(FileData& fileData,
+                                           const std::vector<std::string>& writeNames,
+                                           const std::string& filePath,
+                                           const util::DateTime& dateTime,
+                                           const bool isFirstState) {
+  oops::Log::trace() << "Monio::defineTimeSeries()" << std::endl;
+  const std::string timeDimName = std::string(consts::kTimeDimName);
+  const std::string timeVarName = std::string(consts::kTimeVarName);
+  // The first state written sets the time origin. States appended take the next time step.
+  std::size_t timeStep = 0;
+  std::string timeOrigin = convertToLfricDateTimeStr(dateTime);
+  Metadata& metadata = fileData.getMetadata();
+  if (isFirstState == false) {
+    if (utils::fileExists(filePath) == false) {
+      Monio::get().closeFiles();
+      utils::throwException("Monio::defineTimeSeries()> File \"" + filePath +
+                            "\" to append to does not exist...");
+    }
+    FileData appendFileData;
+    reader_.openFile(filePath);
+    reader_.readMetadata(appendFileData);
+    reader_.closeFile();
+    Metadata& appendMetadata = appendFileData.getMetadata();
+    checkTimeSeries(appendMetadata, metadata, writeNames, filePath);
+    timeStep = appendMetadata.getDimension(timeDimName);
+    timeOrigin = appendMetadata.getVariable(timeVarName)->getStrAttr(
+                                                            std::string(consts::kTimeOriginName));
+  }
+  metadata.addDimension(timeDimName, consts::kUnlimitedDimSize);
+  for (const auto& writeName : writeNames) {
+    std::vector<std::pair<std::string, size_t>>& dimensions =
+                                        metadata.getVariable(writeName)->getDimensionsMap();
+    dimensions.insert(dimensions.begin(), {timeDimName, consts::kUnlimitedDimSize});
+  }
+  std::shared_ptr<monio::Variable> timeVar = std::make_shared<Variable>(timeVarName,
+                                                                        consts::eDouble);
+  timeVar->addDimension(timeDimName, consts::kUnlimitedDimSize);
+  timeVar->addAttribute(std::make_shared<AttributeString>("standard_name", "time"));
+  timeVar->addAttribute(std::make_shared<AttributeString>("calendar", "gregorian"));
+  timeVar->addAttribute(std::make_shared<AttributeString>("units", "seconds since " + timeOrigin));
+  timeVar->addAttribute(std::make_shared<AttributeString>(std::string(consts::kTimeOriginName),
+                                                          timeOrigin));
+  metadata.addVariable(timeVarName, timeVar);
+
+  const util::DateTime originDateTime(convertToAtlasDateTimeStr(timeOrigin));
+  std::shared_ptr<DataContainerDouble> timeContainer =
+        std::make_shared<DataContainerDouble>(timeVarName);
+  timeContainer->setData({static_cast<double>((dateTime - originDateTime).toSeconds())});
+  fileData.getData().addContainer(timeContainer);
+  return timeStep;
+}
+
+void monio::Monio::checkTimeSeries(Metadata& appendMetadata,
+                                   Metadata& metadata,
+                                   const std::vector<std::string>& writeNames,
+                                   const std::string& filePath) {
+  oops::Log::trace() << "Monio::checkTimeSeries()" << std::endl;
+  const std::string timeDimName = std::string(consts::kTimeDimName);
+  const std::string timeVarName = std::string(consts::kTimeVarName);
+  const std::string errorPrefix = "Monio::checkTimeSeries()> File \"" + filePath + "\" ";
+  std::map<std::string, std::shared_ptr<Variable>>& appendVarsMap =
+                                                              appendMetadata.getVariablesMap();
+  // Files written by writeState hold no time series
+  if (appendMetadata.isDimDefined(timeDimName) == false ||
+      appendVarsMap.find(timeVarName) == appendVarsMap.end() ||
+      appendVarsMap.at(timeVarName)->getAttributes().count(
+                                        std::string(consts::kTimeOriginName)) == 0) {
+    Monio::get().closeFiles();
+    utils::throwException(errorPrefix + "holds no time series to append to. Files appended to "
+                          "must be created by appendState...");
+  }
+  for (const auto& writeName : writeNames) {
+    if (appendVarsMap.find(writeName) == appendVarsMap.end()) {
+      Monio::get().closeFiles();
+      utils::throwException(errorPrefix + "has no variable \"" + writeName + "\" to append to...");
+    }
+    std::shared_ptr<Variable> appendVar = appendVarsMap.at(writeName);
+    std::shared_ptr<Variable> var = metadata.getVariable(writeName);
+    // Packed variables are read with the type of their unpacked data
+    const int type = var->getType();
+    const bool isPacked = type == consts::eShort || type == consts::eByte;
+    const bool isAppendPacked = appendVar->getAttributes().count(
+                                    std::string(consts::kScaleFactorName)) != 0;
+    if (isPacked != isAppendPacked || (isPacked == false && appendVar->getType() != type)) {
+      Monio::get().closeFiles();
+      utils::throwException(errorPrefix + "variable \"" + writeName + "\" has a different type "
+                            "to the field appended...");
+    }
+    std::vector<std::pair<std::string, size_t>> appendDimensions;
+    for (const auto& dimension : appendVar->getDimensionsMap()) {
+      if (dimension.first != timeDimName) {
+        appendDimensions.push_back(dimension);
+      }
+    }
+    if (appendDimensions != var->getDimensionsMap()) {
+      Monio::get().closeFiles();
+      utils::throwException(errorPrefix + "variable \"" + writeName + "\" has different "
+                            "dimensions or levels to the field appended...");
+    }
+  }
+}
+
 void monio::Monio::addJediData(FileData& fileData) {
   Metadata& metadata = fileData.getMetadata();
   Data& data = fileData.getData();
@@ -14,10 +14,16 @@
 #include <utility>
 #include <vector>
 
-#include "AtlasReader.h"
 #include "AtlasWriter.h"
+#include "FieldGatherer.h"
+#include "FieldScatterer.h"
 #include "FileData.h"
+#include "LfricAtlasMapCache.h"
+#include "ParallelReader.h"
+#include "ParallelWriter.h"
+#include "ReadPipeline.h"
 #include "Reader.h"
+#include "WriteBehind.h"
 #include "Writer.h"
 
 namespace monio {
@@ -43,6 +49,14 @@ class Monio {
            const std::string& filePath,
            const util::DateTime& dateTime);
 
+  /// \brief Reads a state file at several date-times, e.g. the time slots of a 4D window, into one
+  ///        field set per date-time. The file is initialised once, and consecutive time steps are
+  ///        read together, with one hyperslab per variable.
+  void readStates(std::vector<atlas::FieldSet>& localFieldSets,
+                  const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                  const std::string& filePath,
+                  const std::vector<util::DateTime>& dateTimes);
+
   /// \brief Reads files without a time component, i.e. increment files.
   void readIncrements(atlas::FieldSet& localFieldSet,
                 const std::vector<consts::FieldMetadata>& fieldMetadataVec,
@@ -62,6 +76,19 @@ class Monio {
                   const std::string& filePath,
                   const bool isLfricConvention = true);
 
+  /// \brief Writes a state at a date-time into the time series of a file, so that the states of a
+  ///        trajectory are held in one file. Where isFirstState is true the file is created, or
+  ///        replaced, with an unlimited time dimension, and mesh data are written. Otherwise the
+  ///        state is appended at the next time step of an existing file created by appendState,
+  ///        and only its date-time and fields are written. Appends are written by the owning PE
+  ///        and are not asynchronous.
+  void appendState(const atlas::FieldSet& localFieldSet,
+                   const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                   const std::string& filePath,
+                   const util::DateTime& dateTime,
+                   const bool isFirstState,
+                   const bool isLfricConvention = true);
+
   /// \brief Writes an field set to file. Intended debugging and testing only.
   void writeFieldSet(const atlas::FieldSet& localFieldSet,
                      const std::string& filePath);
@@ -69,6 +96,68 @@ class Monio {
   /// \brief Can be called elsewhere in MONIO to free disk resources more quickly.
   void closeFiles();
 
+  /// \brief Enables a persistent, on-disk cache of LFRic-Atlas maps in the given directory. Cached
+  ///        maps are re-used by subsequent runs with the same grid and mesh.
+  void setMapCacheDirectory(const std::string& cacheDirPath);
+
+  /// \brief Starts creation of LFRic-Atlas maps in the background for a set of grids. Takes a map
+  ///        of grid names to paths of files containing the LFRic mesh at that resolution. Maps are
+  ///        collected when the corresponding grid is next initialised.
+  void warmMapCache(const std::map<std::string, std::string>& gridFilePaths);
+
+  /// \brief Sets the PEs used to read fields. Fields are shared among these by size and each I/O
+  ///        rank reads, reorders and scatters its own fields. Must be called by all PEs with the
+  ///        same ranks. The owning PE is always included. Defaults to the owning PE only.
+  void setIORanks(const std::vector<int>& ioRanks);
+
+  /// \brief Enables reads with parallel NetCDF. All PEs read the columns they own directly from
+  ///        file and no global fields are created. Requires NetCDF built with parallel I/O. Must be
+  ///        called by all PEs. Takes precedence over multiple I/O ranks.
+  void setParallelRead(const bool isParallelRead);
+
+  /// \brief Enables writes of increments and states with parallel NetCDF. The owning PE defines
+  ///        the file and writes the mesh, then all PEs write the columns they own. No global fields
+  ///        are created. Requires NetCDF built with parallel I/O. Must be called by all PEs.
+  void setParallelWrite(const bool isParallelWrite);
+
+  /// \brief Enables asynchronous writes of increments and states. Calls return once fields have
+  ///        been gathered to the owning PE, which then writes the file on a background thread.
+  ///        Must be called by all PEs. Has no effect on parallel writes.
+  void setAsyncWrite(const bool isAsyncWrite);
+
+  /// \brief Waits for all asynchronous writes to complete. Also called by closeFiles(), and before
+  ///        any other file is opened.
+  void waitForWrites();
+
+  /// \brief Sets the chunking and compression of the field variables of subsequently written
+  ///        increment and state files. Mesh variables are unaffected. Must be called by all PEs.
+  void setStorageOptions(const consts::StorageOptions& storageOptions);
+
+  /// \brief Sets the storage of a single field, by JEDI name, in subsequently written increment
+  ///        and state files. Takes precedence over the storage set for all fields. Used, for
+  ///        example, to quantise each field to its own precision. Must be called by all PEs.
+  void setStorageOptions(const std::string& jediName,
+                         const consts::StorageOptions& storageOptions);
+
+  /// \brief Clears the storage set for a single field, by JEDI name, so that it takes the storage
+  ///        set for all fields. Must be called by all PEs.
+  void clearStorageOptions(const std::string& jediName);
+
+  /// \brief Sets the number of fields each I/O rank reads ahead of their distribution, on a
+  ///        dedicated I/O thread. Zero disables the I/O thread. Must be called by all PEs.
+  void setReadBufferCount(const std::size_t numBuffers);
+
+  /// \brief Sets the number of levels each I/O rank reads and scatters at once. Fields with more
+  ///        levels are read from file in blocks, so that memory on I/O ranks is bounded by the size
+  ///        of a block rather than of a field. Zero reads whole fields. Must be called by all PEs.
+  void setReadBlockLevels(const std::size_t numLevels);
+
+  /// \brief Sets the number of levels gathered and written at once in serial writes. Fields with
+  ///        more levels are written in blocks, so that memory on the owning PE is bounded by the
+  ///        size of a block rather than of a field. Zero writes whole fields. Has no effect where
+  ///        writes are asynchronous. Must be called by all PEs.
+  void setWriteBlockLevels(const std::size_t numLevels);
+
   /// \brief A call to open and initialise a state file for reading. This function is public whilst
   ///        it's called from LFRic-Lite.
   int initialiseFile(const atlas::Grid& grid,
@@ -85,17 +174,120 @@ class Monio {
   FileData& createFileData(const std::string& gridName,
                            const std::string& filePath);
 
+  /// \brief Returns a reference to the data read and produced during file initialisation. Used on
+  ///        the owning PE only, where a read spans many fields of the same file.
+  FileData& getStoredFileData(const std::string& gridName);
+
+  /// \brief Returns true if this PE is one of the I/O ranks.
+  bool isIORank();
+
+  /// \brief Throws where quantisation is applied without a valid precision. NetCDF limits the
+  ///        precision of float variables further, which is checked as variables are defined.
+  void validateStorageOptions(const consts::StorageOptions& storageOptions);
+
+  /// \brief Returns the Reader that acts on this PE. This is reader_ except on the other I/O ranks.
+  Reader& getReader();
+
+  /// \brief Assigns fields to I/O ranks by size. Returns the I/O rank that reads each field. Called
+  ///        by all PEs with the same result.
+  std::vector<std::size_t> assignFieldsToIORanks(const atlas::FieldSet& localFieldSet,
+                                    const std::vector<consts::FieldMetadata>& fieldMetadataVec);
+
+  /// \brief Returns the level remap by which a field is read. Fields are read from file level
+  ///        FieldMetadata.readLevelStart where it is set, otherwise as per noFirstLevel.
+  consts::LevelRemap getReadLevelRemap(const consts::FieldMetadata& fieldMetadata,
+                                       const std::size_t numLevels,
+                                       const int variableConvention);
+
+  /// \brief Reads the file levels of the fields at readIndices on the I/O thread, and scatters
+  ///        them to local fields as they are read, then updates the halos of all read fields.
+  ///        Called by all PEs, each with the indices of the fields it reads. Each field set takes
+  ///        a consecutive time step from timeStep. Fields are read in blocks of readBlockLevels_
+  ///        levels where set and a single field set is read.
+  void readFieldsInSerial(std::vector<atlas::FieldSet>& localFieldSets,
+                          const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                          const std::vector<std::size_t>& sourceRanks,
+                          const std::vector<std::size_t>& readIndices,
+                          const std::vector<std::string>& readNames,
+                          const std::vector<bool>& isFieldRead,
+                          const std::string& gridName,
+                          const int variableConvention,
+                          const std::size_t timeStep);
+
+  /// \brief Reads all fields with parallel NetCDF, into one field set per time step. Called by all
+  ///        PEs after file initialisation. The file is opened, and the read plan created, once for
+  ///        all time steps. Time steps are ignored where variables have no time dimension.
+  void readFieldsInParallel(std::vector<atlas::FieldSet>& localFieldSets,
+                            const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                            const std::string& filePath,
+                            const std::string& gridName,
+                            int variableConvention,
+                            std::vector<std::size_t> timeSteps);
+
+  /// \brief Creates the metadata of all fields to be written, ahead of any data, so that the output
+  ///        file is defined in a single pass. Returns the write name of each field. Variables take
+  ///        LFRic write names for increments and LFRic read names for states, or JEDI names where
+  ///        isLfricConvention is false. Called by all PEs.
+  std::vector<std::string> defineFields(const atlas::FieldSet& localFieldSet,
+                                 const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                                 FileData& fileData,
+                                 const bool isLfricConvention,
+                                 const bool isIncrement);
+
+  /// \brief Gathers fields to the owning PE in turn and writes them, in blocks of
+  ///        writeBlockLevels_ levels where set, or queues the file for writing where writes are
+  ///        asynchronous. Called by all PEs with file data prepared for writing by defineFields.
+  ///        Where isAppend is true, file data are prepared by defineTimeSeries, and fields are
+  ///        written at timeStep of a file created where timeStep is zero, and opened otherwise.
+  void writeFieldsInSerial(const atlas::FieldSet& localFieldSet,
+                           const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                           const std::vector<std::string>& writeNames,
+                           const std::string& filePath,
+                           FileData& fileData,
+                           const bool isLfricConvention,
+                           const std::size_t timeStep,
+                           const bool isAppend);
+
+  /// \brief Writes all fields with parallel NetCDF. Called by all PEs with file data prepared for
+  ///        writing by defineFields.
+  void writeFieldsInParallel(const atlas::FieldSet& localFieldSet,
+                             const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                             const std::vector<std::string>& writeNames,
+                             const std::string& filePath,
+                             FileData& fileData,
+                             const bool isLfricConvention);
+
   /// \brief Returns a copy of the data read and produced during file initialisation.
   FileData getFileData(const std::string& gridName);
 
   /// \brief Creates and stores a map between Atlas and LFRic horizontal ordering.
   void createLfricAtlasMap(FileData& fileData, const atlas::CubedSphereGrid& grid);
 
+  /// \brief Sends the LFRic-Atlas map created on the owning PE to the other I/O ranks.
+  void shareLfricAtlasMap(FileData& fileData);
+
   /// \brief Creates and stores date-times from a state file.
   void createDateTimes(FileData& fileData,
                        const std::string& timeVarName,
                        const std::string& timeOriginName);
 
+  /// \brief Adds an unlimited time dimension to file data prepared by defineFields, with the
+  ///        date-time of a state. Where the state is not the first, the time origin and number of
+  ///        time steps are read from the existing file, once checked by checkTimeSeries. Returns
+  ///        the time step at which the state is written. Called on the owning PE only.
+  std::size_t defineTimeSeries(FileData& fileData,
+                               const std::vector<std::string>& writeNames,
+                               const std::string& filePath,
+                               const util::DateTime& dateTime,
+                               const bool isFirstState);
+
+  /// \brief Checks that a file appended to holds a time series, and that each of writeNames is a
+  ///        variable of it with the type and dimensions of the field appended. Throws otherwise.
+  void checkTimeSeries(Metadata& appendMetadata,
+                       Metadata& metadata,
+                       const std::vector<std::string>& writeNames,
+                       const std::string& filePath);
+
   /// \brief Adds vertical meta/data for writing of JEDI-only increment files.
   void addJediData(FileData& fileData);
 
@@ -117,10 +309,41 @@ class Monio {
   /// \brief A member instance of Writer.
   Writer writer_;
 
-  /// \brief A member instance of AtlasReader.
-  AtlasReader atlasReader_;
   /// \brief A member instance of AtlasWriter.
   AtlasWriter atlasWriter_;
+  /// \brief Gathers fields to the owning PE for serial writes.
+  FieldGatherer fieldGatherer_;
+  /// \brief Distributes fields read on the I/O ranks.
+  FieldScatterer fieldScatterer_;
+
+  /// \brief PEs that read fields. Always includes mpiRankOwner_.
+  std::vector<std::size_t> ioRanks_;
+  /// \brief Reader for this PE where it is an I/O rank other than mpiRankOwner_.
+  std::unique_ptr<Reader> ioReader_;
+  /// \brief Reads fields ahead of their distribution on I/O ranks.
+  ReadPipeline readPipeline_;
+  std::size_t numReadBuffers_;
+  /// \brief Number of levels read and scattered at once. Zero where whole fields are read.
+  std::size_t readBlockLevels_;
+  /// \brief Number of levels gathered and written at once. Zero where whole fields are written.
+  std::size_t writeBlockLevels_;
+
+  /// \brief A member instance of ParallelReader. Used on all PEs where isParallelRead_ is true.
+  ParallelReader parallelReader_;
+  bool isParallelRead_;
+  /// \brief A member instance of ParallelWriter. Used on all PEs where isParallelWrite_ is true.
+  ParallelWriter parallelWriter_;
+  bool isParallelWrite_;
+  /// \brief Writes files on the owning PE in the background where isAsyncWrite_ is true.
+  WriteBehind writeBehind_;
+  bool isAsyncWrite_;
+  /// \brief Storage of field variables in written files.
+  consts::StorageOptions storageOptions_;
+  /// \brief Storage of individual field variables, keyed by JEDI name.
+  std::map<std::string, consts::StorageOptions> fieldStorageOptions_;
+
+  /// \brief Holds LFRic-Atlas maps in memory and on disk so they are created once per mesh.
+  LfricAtlasMapCache mapCache_;
 
   /// \brief Store of read file meta/data used for writing. Keyed by grid name for storage of data
   ///        at different resolutions.
@@ -0,0 +1,120 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "ParallelPlan.h"
+
+#include <algorithm>
+
+#include "oops/util/Logger.h"
+
+#include "Monio.h"
+#include "Utils.h"
+#include "UtilsAtlas.h"
+
+monio::ParallelPlan::ParallelPlan():
+    maxNumRanges_(0),
+    horizontalSize_(0),
+    isIdentity_(false) {
+  oops::Log::trace() << "ParallelPlan::ParallelPlan()" << std::endl;
+}
+
+void monio::ParallelPlan::create(const eckit::mpi::Comm& mpiCommunicator,
+                                 const atlas::Field& field,
+                                 const std::vector<uint32_t>& lfricAtlasMap,
+                                 const std::size_t maxGap) {
+  oops::Log::trace() << "ParallelPlan::create()" << std::endl;
+  horizontalSize_ = lfricAtlasMap.size();
+  std::vector<atlas::idx_t> ownedNodeIndices;
+  std::vector<int> globalIndices;
+  utilsatlas::getOwnedNodes(field, ownedNodeIndices, globalIndices);
+  // Pairs of file index and local node index for all nodes owned by this PE.
+  std::vector<std::pair<std::size_t, atlas::idx_t>> fileNodeIndices;
+  for (std::size_t node = 0; node < ownedNodeIndices.size(); ++node) {
+    const std::size_t globalIndex = globalIndices[node];
+    if (globalIndex >= horizontalSize_) {
+      Monio::get().closeFiles();
+      utils::throwException("ParallelPlan::create()> "
+                            "Configured grid is not compatible with the LFRic-Atlas map...");
+    }
+    fileNodeIndices.push_back({lfricAtlasMap[globalIndex], ownedNodeIndices[node]});
+  }
+  std::sort(fileNodeIndices.begin(), fileNodeIndices.end());
+  fileRanges_.clear();
+  nodeIndices_.clear();
+  nodeRangeIndices_.clear();
+  nodeRangePositions_.clear();
+  for (const auto& fileNodePair : fileNodeIndices) {
+    const std::size_t fileIndex = fileNodePair.first;
+    if (fileRanges_.size() == 0 || fileIndex > fileRanges_.back().first +
+        fileRanges_.back().second + maxGap) {
+      fileRanges_.push_back({fileIndex, 1});
+    } else {
+      fileRanges_.back().second = fileIndex - fileRanges_.back().first + 1;
+    }
+    nodeIndices_.push_back(fileNodePair.second);
+    nodeRangeIndices_.push_back(fileRanges_.size() - 1);
+    nodeRangePositions_.push_back(fileIndex - fileRanges_.back().first);
+  }
+  isIdentity_ = fileRanges_.size() == 1 && fileRanges_.front().second == nodeIndices_.size();
+  for (std::size_t node = 0; node < nodeIndices_.size() && isIdentity_ == true; ++node) {
+    isIdentity_ = nodeIndices_[node] == static_cast<atlas::idx_t>(node);
+  }
+  maxNumRanges_ = fileRanges_.size();
+  mpiCommunicator.allReduceInPlace(maxNumRanges_, eckit::mpi::max());
+  oops::Log::debug() << "ParallelPlan::create()> " << nodeIndices_.size() <<
+                        " owned columns in " << fileRanges_.size() << " ranges" << std::endl;
+}
+
+bool monio::ParallelPlan::isCreated() const {
+  return horizontalSize_ != 0;
+}
+
+std::vector<std::size_t> monio::ParallelPlan::getRangeOffsets(const std::size_t numLevels) const {
+  std::vector<std::size_t> rangeOffsets(fileRanges_.size(), 0);
+  for (std::size_t range = 1; range < fileRanges_.size(); ++range) {
+    rangeOffsets[range] = rangeOffsets[range - 1] + (fileRanges_[range - 1].second * numLevels);
+  }
+  return rangeOffsets;
+}
+
+std::size_t monio::ParallelPlan::getBufferSize(const std::size_t numLevels) const {
+  std::size_t bufferSize = 0;
+  for (const auto& fileRange : fileRanges_) {
+    bufferSize += fileRange.second * numLevels;
+  }
+  return bufferSize;
+}
+
+const std::vector<std::pair<std::size_t, std::size_t>>&
+    monio::ParallelPlan::getFileRanges() const {
+  return fileRanges_;
+}
+
+std::size_t monio::ParallelPlan::getMaxNumRanges() const {
+  return maxNumRanges_;
+}
+
+std::size_t monio::ParallelPlan::getHorizontalSize() const {
+  return horizontalSize_;
+}
+
+bool monio::ParallelPlan::isIdentity() const {
+  return isIdentity_;
+}
+
+const std::vector<atlas::idx_t>& monio::ParallelPlan::getNodeIndices() const {
+  return nodeIndices_;
+}
+
+const std::vector<std::size_t>& monio::ParallelPlan::getNodeRangeIndices() const {
+  return nodeRangeIndices_;
+}
+
+const std::vector<std::size_t>& monio::ParallelPlan::getNodeRangePositions() const {
+  return nodeRangePositions_;
+}
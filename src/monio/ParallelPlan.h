@@ -0,0 +1,67 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "atlas/field.h"
+#include "eckit/mpi/Comm.h"
+
+namespace monio {
+/// \brief Describes where the columns owned by a PE lie in a file, as contiguous ranges of
+///        horizontal indices. Derived from the LFRic-Atlas map and the partition of a function
+///        space. Used by ParallelReader and ParallelWriter.
+class ParallelPlan {
+ public:
+  ParallelPlan();
+
+  /// \brief Creates the plan. Where file indices are separated by up to maxGap unowned indices they
+  ///        share a range. A maxGap of zero gives ranges of owned indices only. Collective.
+  void create(const eckit::mpi::Comm& mpiCommunicator,
+              const atlas::Field& field,
+              const std::vector<uint32_t>& lfricAtlasMap,
+              const std::size_t maxGap);
+
+  bool isCreated() const;
+
+  /// \brief Returns the offset of each range in a buffer holding numLevels levels of every range.
+  ///        Each range is held as a block of levels, each the width of the range.
+  std::vector<std::size_t> getRangeOffsets(const std::size_t numLevels) const;
+  /// \brief Returns the size of a buffer holding numLevels levels of every range.
+  std::size_t getBufferSize(const std::size_t numLevels) const;
+
+  const std::vector<std::pair<std::size_t, std::size_t>>& getFileRanges() const;
+  std::size_t getMaxNumRanges() const;
+  std::size_t getHorizontalSize() const;
+  /// \brief Returns true where the owned columns form a single range, without gaps, in the order
+  ///        of local nodes from the first. Such columns have the same order in file and field.
+  bool isIdentity() const;
+
+  const std::vector<atlas::idx_t>& getNodeIndices() const;
+  const std::vector<std::size_t>& getNodeRangeIndices() const;
+  const std::vector<std::size_t>& getNodeRangePositions() const;
+
+ private:
+  /// \brief Contiguous ranges of horizontal file indices for this PE, as start and count.
+  std::vector<std::pair<std::size_t, std::size_t>> fileRanges_;
+  /// \brief Greatest number of ranges on any PE. All PEs make this many collective calls.
+  std::size_t maxNumRanges_;
+  /// \brief Size of the horizontal dimension expected in the file.
+  std::size_t horizontalSize_;
+  bool isIdentity_;
+
+  /// \brief Local indices of the nodes owned by this PE.
+  std::vector<atlas::idx_t> nodeIndices_;
+  /// \brief The range holding each owned node and its position within that range.
+  std::vector<std::size_t> nodeRangeIndices_;
+  std::vector<std::size_t> nodeRangePositions_;
+};
+}  // namespace monio
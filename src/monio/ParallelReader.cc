@@ -0,0 +1,289 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "ParallelReader.h"
+
+#include <mpi.h>
+#include <netcdf.h>
+#include <netcdf_par.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "atlas/array.h"
+#include "atlas/functionspace.h"
+#include "oops/util/Logger.h"
+
+#include "Constants.h"
+#include "Monio.h"
+#include "Utils.h"
+#include "UtilsAtlas.h"
+#include "UtilsNetCDF.h"
+
+namespace  {
+  int getVara(int ncId, int varId, const size_t* start, const size_t* count, double* data) {
+    return nc_get_vara_double(ncId, varId, start, count, data);
+  }
+
+  int getVara(int ncId, int varId, const size_t* start, const size_t* count, float* data) {
+    return nc_get_vara_float(ncId, varId, start, count, data);
+  }
+
+  int getVara(int ncId, int varId, const size_t* start, const size_t* count, int* data) {
+    return nc_get_vara_int(ncId, varId, start, count, data);
+  }
+}  // namespace
+
+monio::ParallelReader::ParallelReader(const eckit::mpi::Comm& mpiCommunicator):
+    mpiCommunicator_(mpiCommunicator),
+    ncId_(-1) {
+  oops::Log::trace() << "ParallelReader::ParallelReader()" << std::endl;
+}
+
+monio::ParallelReader::~ParallelReader() {
+  // Closure is collective, so files are expected to be closed by the call that opened them.
+  if (isOpen() == true) {
+    nc_close(ncId_);
+  }
+}
+
+void monio::ParallelReader::openFile(const std::string& filePath) {
+  oops::Log::trace() << "ParallelReader::openFile()" << std::endl;
+  if (isOpen() == true) {
+    closeFile();
+  }
+  MPI_Comm mpiComm = MPI_Comm_f2c(mpiCommunicator_.communicator());
+  int status = nc_open_par(filePath.c_str(), NC_NOWRITE, mpiComm, MPI_INFO_NULL, &ncId_);
+  utilsnetcdf::checkStatus(status, "ParallelReader::openFile()> An exception occurred while "
+                           "accessing \"" + filePath + "\": ");
+}
+
+void monio::ParallelReader::closeFile() {
+  oops::Log::trace() << "ParallelReader::closeFile()" << std::endl;
+  if (isOpen() == true) {
+    int status = nc_close(ncId_);
+    ncId_ = -1;
+    utilsnetcdf::checkStatus(status, "ParallelReader::closeFile()> ");
+  }
+}
+
+bool monio::ParallelReader::isOpen() {
+  return ncId_ >= 0;
+}
+
+void monio::ParallelReader::createReadPlan(const atlas::Field& field,
+                                           const std::vector<uint32_t>& lfricAtlasMap) {
+  oops::Log::trace() << "ParallelReader::createReadPlan()" << std::endl;
+  plan_.create(mpiCommunicator_, field, lfricAtlasMap, consts::kParallelReadMaxGap);
+}
+
+void monio::ParallelReader::readField(atlas::Field& field,
+                                      const std::string& varName,
+                                      const std::size_t timeStep,
+                                      const std::size_t levelStart) {
+  oops::Log::trace() << "ParallelReader::readField()" << std::endl;
+  if (isOpen() == false || plan_.isCreated() == false) {
+    Monio::get().closeFiles();
+    utils::throwException("ParallelReader::readField()> File is not open or no read plan...");
+  }
+  int varId;
+  utilsnetcdf::checkStatus(nc_inq_varid(ncId_, varName.c_str(), &varId),
+                           "ParallelReader::readField()> Variable \"" + varName + "\": ");
+  utilsnetcdf::checkStatus(nc_var_par_access(ncId_, varId, NC_COLLECTIVE),
+                           "ParallelReader::readField()> ");
+  int timeDimId = -1;
+  if (nc_inq_dimid(ncId_, std::string(consts::kTimeDimName).c_str(), &timeDimId) != NC_NOERR) {
+    timeDimId = -1;  // File has no time dimension
+  }
+  int numDims;
+  utilsnetcdf::checkStatus(nc_inq_varndims(ncId_, varId, &numDims),
+                           "ParallelReader::readField()> ");
+  std::vector<int> dimIds(numDims);
+  utilsnetcdf::checkStatus(nc_inq_vardimid(ncId_, varId, dimIds.data()),
+                           "ParallelReader::readField()> ");
+  std::vector<std::size_t> dimSizes(numDims);
+  for (int dim = 0; dim < numDims; ++dim) {
+    utilsnetcdf::checkStatus(nc_inq_dimlen(ncId_, dimIds[dim], &dimSizes[dim]),
+                             "ParallelReader::readField()> ");
+  }
+  if (numDims == 0 || dimSizes.back() != plan_.getHorizontalSize()) {
+    Monio::get().closeFiles();
+    utils::throwException("ParallelReader::readField()> Variable \"" + varName +
+                          "\" is not compatible with the configured grid...");
+  }
+  const std::size_t numLevels = field.shape(consts::eVertical);
+  std::vector<std::size_t> startVec(numDims, 0);
+  std::vector<std::size_t> countVec(numDims, 1);
+  std::size_t numFileLevels = 1;
+  for (int dim = 0; dim < numDims - 1; ++dim) {
+    if (dimIds[dim] == timeDimId) {
+      if (timeStep >= dimSizes[dim]) {
+        Monio::get().closeFiles();
+        utils::throwException("ParallelReader::readField()> Time step exceeds size of \"" +
+                              varName + "\"...");
+      }
+      startVec[dim] = timeStep;
+    } else {
+      numFileLevels = dimSizes[dim];
+      startVec[dim] = levelStart;
+      countVec[dim] = numLevels;
+    }
+  }
+  if (levelStart + numLevels > numFileLevels) {
+    Monio::get().closeFiles();
+    utils::throwException("ParallelReader::readField()> Field \"" + field.name() +
+                          "\" has more levels than variable \"" + varName + "\"...");
+  }
+  // CF-packed data are converted to the field type by NetCDF, then unpacked
+  consts::Packing packing;
+  const bool isPacked = utilsnetcdf::getPacking(ncId_, varId, packing);
+  switch (utilsatlas::atlasTypeToMonioEnum(field.datatype())) {
+    case consts::eDataTypes::eDouble: {
+      readFieldData<double>(field, varId, startVec, countVec, numLevels, isPacked,
+                            packing);
+      break;
+    }
+    case consts::eDataTypes::eFloat: {
+      readFieldData<float>(field, varId, startVec, countVec, numLevels, isPacked,
+                           packing);
+      break;
+    }
+    case consts::eDataTypes::eInt: {
+      readFieldData<int>(field, varId, startVec, countVec, numLevels, false,
+                         packing);
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("ParallelReader::readField()> Data type not coded for...");
+    }
+  }
+}
+
+template<typename T>
+void monio::ParallelReader::readFieldData(atlas::Field& field,
+                                          const int varId,
+                                          const std::vector<std::size_t>& startVec,
+                                          const std::vector<std::size_t>& countVec,
+                                          const std::size_t numLevels,
+                                          const bool isPacked,
+                                          const consts::Packing& packing) {
+  oops::Log::trace() << "ParallelReader::readFieldData()" << std::endl;
+  // Atlas holds the levels of each node together, where files hold the nodes of each level
+  // together. The layouts match only for single-level fields in identity order, which are read
+  // straight into field storage.
+  if (numLevels == 1 && plan_.isIdentity() == true) {
+    auto fieldView = atlas::array::make_view<T, 2>(field);
+    readRanges(varId, startVec, countVec, numLevels, fieldView.data());
+    if (isPacked == true) {
+      utils::unpackData(fieldView.data(), plan_.getNodeIndices().size(), packing);
+    }
+  } else {
+    std::vector<T> buffer(plan_.getBufferSize(numLevels));
+    readRanges(varId, startVec, countVec, numLevels, buffer.data());
+    if (isPacked == true) {
+      utils::unpackData(buffer, packing);
+    }
+    populateField(field, buffer, numLevels);
+  }
+}
+
+template void monio::ParallelReader::readFieldData<double>(atlas::Field& field,
+                                          const int varId,
+                                          const std::vector<std::size_t>& startVec,
+                                          const std::vector<std::size_t>& countVec,
+                                          const std::size_t numLevels,
+                                          const bool isPacked,
+                                          const consts::Packing& packing);
+template void monio::ParallelReader::readFieldData<float>(atlas::Field& field,
+                                          const int varId,
+                                          const std::vector<std::size_t>& startVec,
+                                          const std::vector<std::size_t>& countVec,
+                                          const std::size_t numLevels,
+                                          const bool isPacked,
+                                          const consts::Packing& packing);
+template void monio::ParallelReader::readFieldData<int>(atlas::Field& field,
+                                          const int varId,
+                                          const std::vector<std::size_t>& startVec,
+                                          const std::vector<std::size_t>& countVec,
+                                          const std::size_t numLevels,
+                                          const bool isPacked,
+                                          const consts::Packing& packing);
+
+template<typename T>
+void monio::ParallelReader::readRanges(const int varId,
+                                       std::vector<std::size_t> startVec,
+                                       std::vector<std::size_t> countVec,
+                                       const std::size_t numLevels,
+                                       T* buffer) {
+  oops::Log::trace() << "ParallelReader::readRanges()" << std::endl;
+  const std::vector<std::pair<std::size_t, std::size_t>>& fileRanges = plan_.getFileRanges();
+  // Every PE makes the same number of collective calls. Those with fewer ranges read nothing.
+  std::size_t offset = 0;
+  for (std::size_t range = 0; range < plan_.getMaxNumRanges(); ++range) {
+    if (range < fileRanges.size()) {
+      startVec.back() = fileRanges[range].first;
+      countVec.back() = fileRanges[range].second;
+    } else {
+      std::fill(startVec.begin(), startVec.end(), 0);
+      std::fill(countVec.begin(), countVec.end(), 0);
+    }
+    int status = getVara(ncId_, varId, startVec.data(), countVec.data(), buffer + offset);
+    utilsnetcdf::checkStatus(status, "ParallelReader::readRanges()> ");
+    if (range < fileRanges.size()) {
+      offset += fileRanges[range].second * numLevels;
+    }
+  }
+}
+
+template void monio::ParallelReader::readRanges<double>(const int varId,
+                                                        std::vector<std::size_t> startVec,
+                                                        std::vector<std::size_t> countVec,
+                                                        const std::size_t numLevels,
+                                                        double* buffer);
+template void monio::ParallelReader::readRanges<float>(const int varId,
+                                                       std::vector<std::size_t> startVec,
+                                                       std::vector<std::size_t> countVec,
+                                                       const std::size_t numLevels,
+                                                       float* buffer);
+template void monio::ParallelReader::readRanges<int>(const int varId,
+                                                     std::vector<std::size_t> startVec,
+                                                     std::vector<std::size_t> countVec,
+                                                     const std::size_t numLevels,
+                                                     int* buffer);
+
+template<typename T>
+void monio::ParallelReader::populateField(atlas::Field& field,
+                                          const std::vector<T>& buffer,
+                                          const std::size_t numLevels) {
+  oops::Log::trace() << "ParallelReader::populateField()" << std::endl;
+  const std::vector<std::pair<std::size_t, std::size_t>>& fileRanges = plan_.getFileRanges();
+  const std::vector<atlas::idx_t>& nodeIndices = plan_.getNodeIndices();
+  const std::vector<std::size_t>& nodeRangeIndices = plan_.getNodeRangeIndices();
+  const std::vector<std::size_t>& nodeRangePositions = plan_.getNodeRangePositions();
+  std::vector<std::size_t> rangeOffsets = plan_.getRangeOffsets(numLevels);
+  auto fieldView = atlas::array::make_view<T, 2>(field);
+  for (std::size_t node = 0; node < nodeIndices.size(); ++node) {
+    const std::size_t range = nodeRangeIndices[node];
+    const std::size_t rangeWidth = fileRanges[range].second;
+    const std::size_t index = rangeOffsets[range] + nodeRangePositions[node];
+    for (std::size_t j = 0; j < numLevels; ++j) {
+      fieldView(nodeIndices[node], j) = buffer[index + (j * rangeWidth)];
+    }
+  }
+}
+
+template void monio::ParallelReader::populateField<double>(atlas::Field& field,
+                                                           const std::vector<double>& buffer,
+                                                           const std::size_t numLevels);
+template void monio::ParallelReader::populateField<float>(atlas::Field& field,
+                                                          const std::vector<float>& buffer,
+                                                          const std::size_t numLevels);
+template void monio::ParallelReader::populateField<int>(atlas::Field& field,
+                                                        const std::vector<int>& buffer,
+                                                        const std::size_t numLevels);
@@ -0,0 +1,86 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "atlas/field.h"
+#include "eckit/mpi/Comm.h"
+
+#include "Constants.h"
+#include "ParallelPlan.h"
+
+namespace monio {
+/// \brief Uses Unidata's C NetCDF library with parallel access (MPI-IO). All PEs open the file and
+///        collectively read the columns they own directly into the local partitions of Atlas
+///        fields. No global field is created and no scatter is required.
+class ParallelReader {
+ public:
+  explicit ParallelReader(const eckit::mpi::Comm& mpiCommunicator);
+  ~ParallelReader();
+
+  ParallelReader()                                  = delete;  //!< Deleted default constructor
+  ParallelReader(ParallelReader&&)                  = delete;  //!< Deleted move constructor
+  ParallelReader(const ParallelReader&)             = delete;  //!< Deleted copy constructor
+  ParallelReader& operator=(ParallelReader&&)       = delete;  //!< Deleted move assignment
+  ParallelReader& operator=(const ParallelReader&)  = delete;  //!< Deleted copy assignment
+
+  /// \brief Opens a file for reading on all PEs. Collective.
+  void openFile(const std::string& filePath);
+  /// \brief Closes the file on all PEs. Collective.
+  void closeFile();
+  bool isOpen();
+
+  /// \brief Derives the ranges of horizontal file indices owned by this PE from the LFRic-Atlas map
+  ///        and the partition of the field's function space. Required before reading. Collective.
+  void createReadPlan(const atlas::Field& field, const std::vector<uint32_t>& lfricAtlasMap);
+
+  /// \brief Reads a variable into the columns of a field owned by this PE, from file level
+  ///        levelStart onwards. Only the levels of the field are read. The time step is ignored
+  ///        for variables without a time dimension. Halos are not updated. Collective.
+  void readField(atlas::Field& field,
+                 const std::string& varName,
+                 const std::size_t timeStep,
+                 const std::size_t levelStart);
+
+ private:
+  /// \brief Reads a variable into the owned columns of a field of type T, unpacking data where
+  ///        required. Data are read into field storage directly where the layouts match.
+  template<typename T> void readFieldData(atlas::Field& field,
+                                          const int varId,
+                                          const std::vector<std::size_t>& startVec,
+                                          const std::vector<std::size_t>& countVec,
+                                          const std::size_t numLevels,
+                                          const bool isPacked,
+                                          const consts::Packing& packing);
+
+  /// \brief Reads the planned ranges of a variable into a buffer with one block per range. Each
+  ///        block holds the requested levels in file order. The buffer is sized by the plan.
+  template<typename T> void readRanges(const int varId,
+                                       std::vector<std::size_t> startVec,
+                                       std::vector<std::size_t> countVec,
+                                       const std::size_t numLevels,
+                                       T* buffer);
+
+  /// \brief Copies read data from the buffer into the owned columns of a field.
+  template<typename T> void populateField(atlas::Field& field,
+                                          const std::vector<T>& buffer,
+                                          const std::size_t numLevels);
+
+  const eckit::mpi::Comm& mpiCommunicator_;
+
+  /// \brief NetCDF ID of the open file. Negative where no file is open.
+  int ncId_;
+
+  /// \brief Locations in the file of the columns owned by this PE.
+  ParallelPlan plan_;
+};
+}  // namespace monio
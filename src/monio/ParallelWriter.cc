@@ -0,0 +1,250 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "ParallelWriter.h"
+
+#include <mpi.h>
+#include <netcdf.h>
+#include <netcdf_par.h>
+
+#include <algorithm>
+#include <utility>
+
+#include "atlas/array.h"
+#include "oops/util/Logger.h"
+
+#include "Constants.h"
+#include "Monio.h"
+#include "Utils.h"
+#include "UtilsAtlas.h"
+#include "UtilsNetCDF.h"
+
+namespace  {
+  int putVara(int ncId, int varId, const size_t* start, const size_t* count, const double* data) {
+    return nc_put_vara_double(ncId, varId, start, count, data);
+  }
+
+  int putVara(int ncId, int varId, const size_t* start, const size_t* count, const float* data) {
+    return nc_put_vara_float(ncId, varId, start, count, data);
+  }
+
+  int putVara(int ncId, int varId, const size_t* start, const size_t* count, const int* data) {
+    return nc_put_vara_int(ncId, varId, start, count, data);
+  }
+}  // namespace
+
+monio::ParallelWriter::ParallelWriter(const eckit::mpi::Comm& mpiCommunicator):
+    mpiCommunicator_(mpiCommunicator),
+    ncId_(-1) {
+  oops::Log::trace() << "ParallelWriter::ParallelWriter()" << std::endl;
+}
+
+monio::ParallelWriter::~ParallelWriter() {
+  // Closure is collective, so files are expected to be closed by the call that opened them.
+  if (isOpen() == true) {
+    nc_close(ncId_);
+  }
+}
+
+void monio::ParallelWriter::openFile(const std::string& filePath) {
+  oops::Log::trace() << "ParallelWriter::openFile()" << std::endl;
+  if (isOpen() == true) {
+    closeFile();
+  }
+  MPI_Comm mpiComm = MPI_Comm_f2c(mpiCommunicator_.communicator());
+  int status = nc_open_par(filePath.c_str(), NC_WRITE, mpiComm, MPI_INFO_NULL, &ncId_);
+  utilsnetcdf::checkStatus(status, "ParallelWriter::openFile()> An exception occurred while "
+                           "accessing \"" + filePath + "\": ");
+}
+
+void monio::ParallelWriter::closeFile() {
+  oops::Log::trace() << "ParallelWriter::closeFile()" << std::endl;
+  if (isOpen() == true) {
+    int status = nc_close(ncId_);
+    ncId_ = -1;
+    utilsnetcdf::checkStatus(status, "ParallelWriter::closeFile()> ");
+  }
+}
+
+bool monio::ParallelWriter::isOpen() {
+  return ncId_ >= 0;
+}
+
+void monio::ParallelWriter::createWritePlan(const atlas::Field& field,
+                                            const std::vector<uint32_t>& lfricAtlasMap) {
+  oops::Log::trace() << "ParallelWriter::createWritePlan()" << std::endl;
+  // Ranges must not span indices owned by other PEs, which would be overwritten.
+  plan_.create(mpiCommunicator_, field, lfricAtlasMap, 0);
+}
+
+void monio::ParallelWriter::writeField(const atlas::Field& field,
+                                       const std::string& varName,
+                                       const bool noFirstLevel,
+                                       const bool isLfricConvention) {
+  oops::Log::trace() << "ParallelWriter::writeField()" << std::endl;
+  if (isOpen() == false || plan_.isCreated() == false) {
+    Monio::get().closeFiles();
+    utils::throwException("ParallelWriter::writeField()> File is not open or no write plan...");
+  }
+  int varId;
+  utilsnetcdf::checkStatus(nc_inq_varid(ncId_, varName.c_str(), &varId),
+                           "ParallelWriter::writeField()> Variable \"" + varName + "\": ");
+  utilsnetcdf::checkStatus(nc_var_par_access(ncId_, varId, NC_COLLECTIVE),
+                           "ParallelWriter::writeField()> ");
+  int numDims;
+  utilsnetcdf::checkStatus(nc_inq_varndims(ncId_, varId, &numDims),
+                           "ParallelWriter::writeField()> ");
+  std::vector<int> dimIds(numDims);
+  utilsnetcdf::checkStatus(nc_inq_vardimid(ncId_, varId, dimIds.data()),
+                           "ParallelWriter::writeField()> ");
+  std::vector<std::size_t> dimSizes(numDims);
+  for (int dim = 0; dim < numDims; ++dim) {
+    utilsnetcdf::checkStatus(nc_inq_dimlen(ncId_, dimIds[dim], &dimSizes[dim]),
+                             "ParallelWriter::writeField()> ");
+  }
+  if (numDims == 0 || numDims > 2 || dimSizes.back() != plan_.getHorizontalSize()) {
+    Monio::get().closeFiles();
+    utils::throwException("ParallelWriter::writeField()> Variable \"" + varName +
+                          "\" is not compatible with the configured grid...");
+  }
+  // Erroneous case. For noFirstLevel == true field should have 70 levels
+  const std::size_t numLevels = field.shape(consts::eVertical);
+  if (noFirstLevel == true && numLevels == consts::kVerticalFullSize) {
+    Monio::get().closeFiles();
+    utils::throwException("ParallelWriter::writeField()> Field levels misconfiguration...");
+  }
+  const std::size_t levelOffset = utils::getLevelRemap(isLfricConvention, noFirstLevel,
+                                                       numLevels).levelOffset;
+  const std::size_t numFileLevels = numDims == 2 ? dimSizes.front() : 1;
+  if (numFileLevels != numLevels + levelOffset) {
+    Monio::get().closeFiles();
+    utils::throwException("ParallelWriter::writeField()> Field \"" + field.name() +
+                          "\" does not match the levels of variable \"" + varName + "\"...");
+  }
+  std::vector<std::size_t> startVec(numDims, 0);
+  std::vector<std::size_t> countVec(numDims, numFileLevels);
+  // Data for CF-packed variables are packed, then converted to the packed type by NetCDF
+  consts::Packing packing;
+  const bool isPacked = utilsnetcdf::getPacking(ncId_, varId, packing);
+  std::size_t numClamped = 0;
+  switch (utilsatlas::atlasTypeToMonioEnum(field.datatype())) {
+    case consts::eDataTypes::eDouble: {
+      std::vector<double> buffer;
+      populateBuffer(field, numFileLevels, levelOffset, buffer);
+      if (isPacked == true) {
+        numClamped = utils::packData(buffer, packing);
+      }
+      writeRanges(varId, startVec, countVec, numFileLevels, buffer);
+      break;
+    }
+    case consts::eDataTypes::eFloat: {
+      std::vector<float> buffer;
+      populateBuffer(field, numFileLevels, levelOffset, buffer);
+      if (isPacked == true) {
+        numClamped = utils::packData(buffer, packing);
+      }
+      writeRanges(varId, startVec, countVec, numFileLevels, buffer);
+      break;
+    }
+    case consts::eDataTypes::eInt: {
+      std::vector<int> buffer;
+      populateBuffer(field, numFileLevels, levelOffset, buffer);
+      writeRanges(varId, startVec, countVec, numFileLevels, buffer);
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("ParallelWriter::writeField()> Data type not coded for...");
+    }
+  }
+  if (numClamped > 0) {
+    oops::Log::warning() << "ParallelWriter::writeField()> " << numClamped << " values of \""
+                         << varName << "\" lie outside its packed range and are clamped..."
+                         << std::endl;
+  }
+}
+
+template<typename T>
+void monio::ParallelWriter::populateBuffer(const atlas::Field& field,
+                                           const std::size_t numFileLevels,
+                                           const std::size_t levelOffset,
+                                           std::vector<T>& buffer) {
+  oops::Log::trace() << "ParallelWriter::populateBuffer()" << std::endl;
+  const std::vector<std::pair<std::size_t, std::size_t>>& fileRanges = plan_.getFileRanges();
+  const std::vector<atlas::idx_t>& nodeIndices = plan_.getNodeIndices();
+  const std::vector<std::size_t>& nodeRangeIndices = plan_.getNodeRangeIndices();
+  const std::vector<std::size_t>& nodeRangePositions = plan_.getNodeRangePositions();
+  std::vector<std::size_t> rangeOffsets = plan_.getRangeOffsets(numFileLevels);
+  buffer.resize(plan_.getBufferSize(numFileLevels));
+  auto fieldView = atlas::array::make_view<const T, 2>(field);
+  for (std::size_t node = 0; node < nodeIndices.size(); ++node) {
+    const std::size_t range = nodeRangeIndices[node];
+    const std::size_t rangeWidth = fileRanges[range].second;
+    const std::size_t index = rangeOffsets[range] + nodeRangePositions[node];
+    for (std::size_t j = 0; j < numFileLevels; ++j) {
+      // Where levelOffset is 1, the zeroth file level is a copy of the first field level.
+      const std::size_t fieldLevel = j < levelOffset ? 0 : j - levelOffset;
+      buffer[index + (j * rangeWidth)] = fieldView(nodeIndices[node], fieldLevel);
+    }
+  }
+}
+
+template void monio::ParallelWriter::populateBuffer<double>(const atlas::Field& field,
+                                                            const std::size_t numFileLevels,
+                                                            const std::size_t levelOffset,
+                                                            std::vector<double>& buffer);
+template void monio::ParallelWriter::populateBuffer<float>(const atlas::Field& field,
+                                                           const std::size_t numFileLevels,
+                                                           const std::size_t levelOffset,
+                                                           std::vector<float>& buffer);
+template void monio::ParallelWriter::populateBuffer<int>(const atlas::Field& field,
+                                                         const std::size_t numFileLevels,
+                                                         const std::size_t levelOffset,
+                                                         std::vector<int>& buffer);
+
+template<typename T>
+void monio::ParallelWriter::writeRanges(const int varId,
+                                        std::vector<std::size_t> startVec,
+                                        std::vector<std::size_t> countVec,
+                                        const std::size_t numFileLevels,
+                                        const std::vector<T>& buffer) {
+  oops::Log::trace() << "ParallelWriter::writeRanges()" << std::endl;
+  const std::vector<std::pair<std::size_t, std::size_t>>& fileRanges = plan_.getFileRanges();
+  // Every PE makes the same number of collective calls. Those with fewer ranges write nothing.
+  std::size_t offset = 0;
+  for (std::size_t range = 0; range < plan_.getMaxNumRanges(); ++range) {
+    if (range < fileRanges.size()) {
+      startVec.back() = fileRanges[range].first;
+      countVec.back() = fileRanges[range].second;
+    } else {
+      std::fill(startVec.begin(), startVec.end(), 0);
+      std::fill(countVec.begin(), countVec.end(), 0);
+    }
+    int status = putVara(ncId_, varId, startVec.data(), countVec.data(), buffer.data() + offset);
+    utilsnetcdf::checkStatus(status, "ParallelWriter::writeRanges()> ");
+    if (range < fileRanges.size()) {
+      offset += fileRanges[range].second * numFileLevels;
+    }
+  }
+}
+
+template void monio::ParallelWriter::writeRanges<double>(const int varId,
+                                                         std::vector<std::size_t> startVec,
+                                                         std::vector<std::size_t> countVec,
+                                                         const std::size_t numFileLevels,
+                                                         const std::vector<double>& buffer);
+template void monio::ParallelWriter::writeRanges<float>(const int varId,
+                                                        std::vector<std::size_t> startVec,
+                                                        std::vector<std::size_t> countVec,
+                                                        const std::size_t numFileLevels,
+                                                        const std::vector<float>& buffer);
+template void monio::ParallelWriter::writeRanges<int>(const int varId,
+                                                      std::vector<std::size_t> startVec,
+                                                      std::vector<std::size_t> countVec,
+                                                      const std::size_t numFileLevels,
+                                                      const std::vector<int>& buffer);
@@ -0,0 +1,77 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "atlas/field.h"
+#include "eckit/mpi/Comm.h"
+
+#include "ParallelPlan.h"
+
+namespace monio {
+/// \brief Uses Unidata's C NetCDF library with parallel access (MPI-IO). All PEs open an existing
+///        file, with variables already defined, and collectively write the columns they own from
+///        the local partitions of Atlas fields. No global field is created and no gather is
+///        required.
+class ParallelWriter {
+ public:
+  explicit ParallelWriter(const eckit::mpi::Comm& mpiCommunicator);
+  ~ParallelWriter();
+
+  ParallelWriter()                                  = delete;  //!< Deleted default constructor
+  ParallelWriter(ParallelWriter&&)                  = delete;  //!< Deleted move constructor
+  ParallelWriter(const ParallelWriter&)             = delete;  //!< Deleted copy constructor
+  ParallelWriter& operator=(ParallelWriter&&)       = delete;  //!< Deleted move assignment
+  ParallelWriter& operator=(const ParallelWriter&)  = delete;  //!< Deleted copy assignment
+
+  /// \brief Opens an existing file for writing on all PEs. Collective.
+  void openFile(const std::string& filePath);
+  /// \brief Closes the file on all PEs. Collective.
+  void closeFile();
+  bool isOpen();
+
+  /// \brief Derives the ranges of horizontal file indices owned by this PE from the LFRic-Atlas map
+  ///        and the partition of the field's function space. Required before writing. Collective.
+  void createWritePlan(const atlas::Field& field, const std::vector<uint32_t>& lfricAtlasMap);
+
+  /// \brief Writes the columns of a field owned by this PE to a variable. Where the zeroth level is
+  ///        missing from an LFRic field it is written as a copy of the first, as per AtlasWriter.
+  ///        Collective.
+  void writeField(const atlas::Field& field,
+                  const std::string& varName,
+                  const bool noFirstLevel,
+                  const bool isLfricConvention);
+
+ private:
+  /// \brief Copies the owned columns of a field into a buffer with one block per range. Each block
+  ///        holds the file levels in order. File level j is taken from field level j - levelOffset.
+  template<typename T> void populateBuffer(const atlas::Field& field,
+                                           const std::size_t numFileLevels,
+                                           const std::size_t levelOffset,
+                                           std::vector<T>& buffer);
+
+  /// \brief Writes the planned ranges of a variable from a buffer populated by populateBuffer.
+  template<typename T> void writeRanges(const int varId,
+                                        std::vector<std::size_t> startVec,
+                                        std::vector<std::size_t> countVec,
+                                        const std::size_t numFileLevels,
+                                        const std::vector<T>& buffer);
+
+  const eckit::mpi::Comm& mpiCommunicator_;
+
+  /// \brief NetCDF ID of the open file. Negative where no file is open.
+  int ncId_;
+
+  /// \brief Locations in the file of the columns owned by this PE.
+  ParallelPlan plan_;
+};
+}  // namespace monio
@@ -0,0 +1,128 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "ReadPipeline.h"
+
+#include <string>
+#include <utility>
+
+#include "oops/util/Logger.h"
+
+#include "Monio.h"
+#include "Utils.h"
+
+monio::ReadPipeline::ReadPipeline():
+    numBuffers_(0),
+    numTaken_(0),
+    isStopped_(true) {
+  oops::Log::trace() << "ReadPipeline::ReadPipeline()" << std::endl;
+}
+
+monio::ReadPipeline::~ReadPipeline() {
+  finish();
+}
+
+void monio::ReadPipeline::start(const std::vector<std::size_t>& fieldIndices,
+                                ReadFunction readField,
+                                const std::size_t numBuffers) {
+  oops::Log::trace() << "ReadPipeline::start()" << std::endl;
+  finish();
+  fieldIndices_ = fieldIndices;
+  readField_ = std::move(readField);
+  numBuffers_ = numBuffers;
+  buffers_.clear();
+  numTaken_ = 0;
+  isStopped_ = false;
+  exception_ = nullptr;
+  if (numBuffers_ != 0 && fieldIndices_.size() != 0) {
+    ioThread_ = std::thread(&ReadPipeline::run, this);
+  }
+}
+
+std::shared_ptr<monio::DataContainerBase> monio::ReadPipeline::take(const std::size_t fieldIndex) {
+  oops::Log::trace() << "ReadPipeline::take()" << std::endl;
+  if (numTaken_ >= fieldIndices_.size() || fieldIndices_[numTaken_] != fieldIndex) {
+    finish();
+    Monio::get().closeFiles();
+    utils::throwException("ReadPipeline::take()> Field " + std::to_string(fieldIndex) +
+                          " taken out of order...");
+  }
+  if (numBuffers_ == 0) {
+    numTaken_++;
+    try {
+      return readField_(fieldIndex);
+    } catch (...) {
+      Monio::get().closeFiles();
+      throw;
+    }
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  condition_.wait(lock, [this] { return buffers_.size() != 0 || exception_ != nullptr; });
+  if (buffers_.size() == 0) {
+    std::exception_ptr exception = exception_;
+    lock.unlock();
+    // Files are closed on this thread once the I/O thread has ended, rather than by the I/O thread
+    finish();
+    Monio::get().closeFiles();
+    try {
+      std::rethrow_exception(exception);
+    } catch (const std::exception& readException) {
+      utils::throwException("ReadPipeline::take()> " + std::string(readException.what()));
+    }
+  }
+  std::shared_ptr<DataContainerBase> dataContainer = std::move(buffers_.front());
+  buffers_.pop_front();
+  numTaken_++;
+  lock.unlock();
+  condition_.notify_all();
+  return dataContainer;
+}
+
+void monio::ReadPipeline::finish() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopped_ = true;
+  }
+  condition_.notify_all();
+  // The I/O thread cannot join itself
+  if (ioThread_.joinable() == true && isIOThread() == false) {
+    ioThread_.join();
+    buffers_.clear();
+  }
+}
+
+bool monio::ReadPipeline::isIOThread() const {
+  return ioThread_.get_id() == std::this_thread::get_id();
+}
+
+void monio::ReadPipeline::run() {
+  utils::setBackgroundThread();
+  for (const auto& fieldIndex : fieldIndices_) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return buffers_.size() < numBuffers_ || isStopped_ == true; });
+      if (isStopped_ == true) {
+        return;
+      }
+    }
+    std::shared_ptr<DataContainerBase> dataContainer;
+    try {
+      dataContainer = readField_(fieldIndex);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      exception_ = std::current_exception();
+      condition_.notify_all();
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      buffers_.push_back(std::move(dataContainer));
+    }
+    condition_.notify_all();
+  }
+}
@@ -0,0 +1,79 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <condition_variable>  // NOLINT(build/c++11)
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>  // NOLINT(build/c++11)
+#include <thread>  // NOLINT(build/c++11)
+#include <vector>
+
+#include "DataContainerBase.h"
+
+namespace monio {
+/// \brief Reads fields ahead of their use on a dedicated I/O thread, so that file reads overlap
+///        with the distribution of fields already read. At most a given number of fields are held
+///        read but not taken. All file access during a pipeline is made by the I/O thread. Where
+///        the number of buffers is zero, fields are read on the calling thread as they are taken.
+///        Where fields are read in blocks of levels, indices identify blocks rather than fields.
+///        The I/O thread makes no MPI calls, so read functions must not communicate, and errors
+///        on it do not abort. They are held until the next take(), which closes files on the
+///        calling thread before raising them with utils::throwException.
+class ReadPipeline {
+ public:
+  /// \brief Reads a field, given its index, and returns its data.
+  using ReadFunction = std::function<std::shared_ptr<DataContainerBase>(std::size_t)>;
+
+  ReadPipeline();
+  ~ReadPipeline();
+
+  ReadPipeline(ReadPipeline&&)                  = delete;  //!< Deleted move constructor
+  ReadPipeline(const ReadPipeline&)             = delete;  //!< Deleted copy constructor
+  ReadPipeline& operator=(ReadPipeline&&)       = delete;  //!< Deleted move assignment
+  ReadPipeline& operator=(const ReadPipeline&)  = delete;  //!< Deleted copy assignment
+
+  /// \brief Starts reading fields in the given order. The read function is called once per field
+  ///        index and returns the field's data.
+  void start(const std::vector<std::size_t>& fieldIndices,
+             ReadFunction readField,
+             const std::size_t numBuffers);
+
+  /// \brief Returns the data of the next field, waiting for it to be read where necessary. Fields
+  ///        must be taken in the order passed to start(). Errors from reads are raised here.
+  std::shared_ptr<DataContainerBase> take(const std::size_t fieldIndex);
+
+  /// \brief Stops reading and waits for the I/O thread to end, unless called from the I/O thread.
+  void finish();
+
+  /// \brief Returns true where called from the I/O thread.
+  bool isIOThread() const;
+
+ private:
+  /// \brief Body of the I/O thread.
+  void run();
+
+  std::vector<std::size_t> fieldIndices_;
+  ReadFunction readField_;
+  std::size_t numBuffers_;
+
+  std::thread ioThread_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+
+  /// \brief Data of fields read but not yet taken, in order.
+  std::deque<std::shared_ptr<DataContainerBase>> buffers_;
+  std::size_t numTaken_;
+  bool isStopped_;
+  /// \brief Holds an exception thrown by the I/O thread until the next take().
+  std::exception_ptr exception_;
+};
+}  // namespace monio
@@ -28,7 +28,8 @@ monio::Reader::Reader(const eckit::mpi::Comm& mpiCommunicator,
                       const int mpiRankOwner,
                       const std::string& filePath):
     mpiCommunicator_(mpiCommunicator),
-    mpiRankOwner_(mpiRankOwner) {
+    mpiRankOwner_(mpiRankOwner),
+    mpiRank_(mpiCommunicator.rank()) {
   oops::Log::trace() << "Reader::Reader()" << std::endl;
   openFile(filePath);
 }
@@ -36,13 +37,14 @@ monio::Reader::Reader(const eckit::mpi::Comm& mpiCommunicator,
 monio::Reader::Reader(const eckit::mpi::Comm& mpiCommunicator,
                       const int mpiRankOwner):
     mpiCommunicator_(mpiCommunicator),
-    mpiRankOwner_(mpiRankOwner) {
+    mpiRankOwner_(mpiRankOwner),
+    mpiRank_(mpiCommunicator.rank()) {
   oops::Log::trace() << "Reader::Reader()" << std::endl;
 }
 
 void monio::Reader::openFile(const std::string& filePath) {
   oops::Log::trace() << "Reader::openFile()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     if (filePath.size() != 0) {
       try {
         file_ = std::make_unique<File>(filePath, netCDF::NcFile::read);
@@ -56,7 +58,7 @@ void monio::Reader::openFile(const std::string& filePath) {
 
 void monio::Reader::closeFile() {
   oops::Log::trace() << "Reader::closeFile()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     if (isOpen() == true) {
       getFile().close();
       file_.reset();
@@ -70,7 +72,7 @@ bool monio::Reader::isOpen() {
 
 void monio::Reader::readMetadata(FileData& fileData) {
   oops::Log::trace() << "Reader::readMetadata()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     getFile().readMetadata(fileData.getMetadata());
   }
 }
@@ -80,7 +82,7 @@ void monio::Reader::readDatumAtTime(FileData& fileData,
                                    const util::DateTime& dateToRead,
                                    const std::string& timeDimName) {
   oops::Log::trace() << "Reader::readDatumAtTime()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     size_t timeStep = findTimeStep(fileData, dateToRead);
     readDatumAtTime(fileData, varName, timeStep, timeDimName);
   }
@@ -91,7 +93,7 @@ void monio::Reader::readDatumAtTime(FileData& fileData,
                                    const size_t timeStep,
                                    const std::string& timeDimName) {
   oops::Log::trace() << "Reader::readDatumAtTime()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     if (fileData.getData().isContainerPresent(varName) == false) {
       std::shared_ptr<Variable> variable = fileData.getMetadata().getVariable(varName);
       int dataType = variable->getType();
@@ -158,9 +160,139 @@ void monio::Reader::readDatumAtTime(FileData& fileData,
   }
 }
 
+std::vector<std::shared_ptr<monio::DataContainerBase>> monio::Reader::readDatumLevels(
+                                                               const FileData& fileData,
+                                                               const std::string& varName,
+                                                               const size_t timeStep,
+                                                               const size_t numTimes,
+                                                               const std::string& timeDimName,
+                                                               const size_t levelStart,
+                                                               const size_t numLevels) {
+  oops::Log::trace() << "Reader::readDatumLevels()" << std::endl;
+  // The file is not closed on error, as this is called on the I/O thread of a ReadPipeline. Files
+  // are closed on the main thread, where errors are rethrown.
+  std::vector<std::shared_ptr<DataContainerBase>> dataContainers(numTimes, nullptr);
+  if (mpiRank_ == mpiRankOwner_) {
+    std::shared_ptr<Variable> variable = fileData.getMetadata().getVariable(varName);
+    int dataType = variable->getType();
+
+    std::vector<size_t> startVec;
+    std::vector<size_t> countVec;
+    std::vector<std::pair<std::string, size_t>> dimensions = variable->getDimensionsMap();
+    size_t numSpatialDims = 0;
+    for (auto const& dimPair : dimensions) {
+      if (dimPair.first != timeDimName) {
+        numSpatialDims++;
+      }
+    }
+    // Variables without a vertical dimension hold a single level. Variables without a time
+    // dimension hold the same data at every time.
+    bool isLevelDim = numSpatialDims > 1;
+    size_t numSlices = 1;
+    for (auto const& dimPair : dimensions) {
+      if (dimPair.first == timeDimName) {
+        if (timeStep + numTimes > dimPair.second) {
+          utils::throwException("Reader::readDatumLevels()> Time steps requested exceed those "
+                                "of \"" + varName + "\"...");
+        }
+        startVec.push_back(timeStep);
+        countVec.push_back(numTimes);
+        numSlices = numTimes;
+      } else if (isLevelDim == true) {
+        if (levelStart + numLevels > dimPair.second) {
+          utils::throwException("Reader::readDatumLevels()> Levels requested exceed those of \"" +
+                                varName + "\"...");
+        }
+        startVec.push_back(levelStart);
+        countVec.push_back(numLevels);
+        isLevelDim = false;
+      } else {
+        startVec.push_back(0);
+        countVec.push_back(dimPair.second);
+      }
+    }
+    if (numSpatialDims <= 1 && (levelStart != 0 || numLevels != 1)) {
+      utils::throwException("Reader::readDatumLevels()> Levels requested exceed those of \"" +
+                            varName + "\"...");
+    }
+    switch (dataType) {
+      case consts::eDataTypes::eDouble: {
+        readDatumSlices<DataContainerDouble, double>(varName, startVec, countVec, numSlices,
+                                                     dataContainers);
+        break;
+      }
+      case consts::eDataTypes::eFloat: {
+        readDatumSlices<DataContainerFloat, float>(varName, startVec, countVec, numSlices,
+                                                   dataContainers);
+        break;
+      }
+      case consts::eDataTypes::eInt: {
+        readDatumSlices<DataContainerInt, int>(varName, startVec, countVec, numSlices,
+                                               dataContainers);
+        break;
+      }
+      default: {
+        utils::throwException("Reader::readDatumLevels()> Data type not coded for...");
+      }
+    }
+  }
+  return dataContainers;
+}
+
+template<typename C, typename T>
+void monio::Reader::readDatumSlices(
+                        const std::string& varName,
+                        const std::vector<size_t>& startVec,
+                        const std::vector<size_t>& countVec,
+                        const size_t numSlices,
+                        std::vector<std::shared_ptr<DataContainerBase>>& dataContainers) {
+  oops::Log::trace() << "Reader::readDatumSlices()" << std::endl;
+  size_t dataSize = 1;
+  for (const auto& count : countVec) {
+    dataSize *= count;
+  }
+  std::vector<T> dataVec(dataSize);
+  getFile().readFieldDatum(varName, startVec, countVec, dataVec);
+  // A single slice takes the data read. Otherwise each slice is copied from the hyperslab.
+  const size_t sliceSize = dataSize / numSlices;
+  for (size_t slice = 0; slice < numSlices; ++slice) {
+    std::shared_ptr<C> dataContainer = std::make_shared<C>(varName);
+    if (numSlices == 1) {
+      dataContainer->getData() = std::move(dataVec);
+    } else {
+      dataContainer->getData().assign(dataVec.begin() + (slice * sliceSize),
+                                      dataVec.begin() + ((slice + 1) * sliceSize));
+    }
+    dataContainers[slice] = std::static_pointer_cast<DataContainerBase>(dataContainer);
+  }
+  // Data without a time dimension are shared by all times
+  for (size_t time = numSlices; time < dataContainers.size(); ++time) {
+    dataContainers[time] = dataContainers[0];
+  }
+}
+
+template void monio::Reader::readDatumSlices<monio::DataContainerDouble, double>(
+                        const std::string& varName,
+                        const std::vector<size_t>& startVec,
+                        const std::vector<size_t>& countVec,
+                        const size_t numSlices,
+                        std::vector<std::shared_ptr<DataContainerBase>>& dataContainers);
+template void monio::Reader::readDatumSlices<monio::DataContainerFloat, float>(
+                        const std::string& varName,
+                        const std::vector<size_t>& startVec,
+                        const std::vector<size_t>& countVec,
+                        const size_t numSlices,
+                        std::vector<std::shared_ptr<DataContainerBase>>& dataContainers);
+template void monio::Reader::readDatumSlices<monio::DataContainerInt, int>(
+                        const std::string& varName,
+                        const std::vector<size_t>& startVec,
+                        const std::vector<size_t>& countVec,
+                        const size_t numSlices,
+                        std::vector<std::shared_ptr<DataContainerBase>>& dataContainers);
+
 void monio::Reader::readAllData(FileData& fileData) {
   oops::Log::trace() << "Reader::readAllData()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     std::vector<std::string> varNames = fileData.getMetadata().getVariableNames();
     readFullData(fileData, varNames);
   }
@@ -169,7 +301,7 @@ void monio::Reader::readAllData(FileData& fileData) {
 void monio::Reader::readFullData(FileData& fileData,
                                  const std::vector<std::string>& varNames) {
   oops::Log::trace() << "Reader::readFullData()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     for (const auto& varName : varNames) {
       readFullDatum(fileData, varName);
     }
@@ -179,7 +311,7 @@ void monio::Reader::readFullData(FileData& fileData,
 void monio::Reader::readFullDatum(FileData& fileData,
                                   const std::string& varName) {
   oops::Log::trace() << "Reader::readFullDatum()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     std::shared_ptr<DataContainerBase> dataContainer = nullptr;
     std::shared_ptr<Variable> variable = fileData.getMetadata().getVariable(varName);
     int dataType = variable->getType();
@@ -238,7 +370,7 @@ std::vector<std::shared_ptr<monio::DataContainerBase>> monio::Reader::getCoordDa
   oops::Log::trace() << "Reader::getCoordData()" << std::endl;
   if (coordNames.size() == 2) {
     std::vector<std::shared_ptr<monio::DataContainerBase>> coordContainers;
-    if (mpiCommunicator_.rank() == mpiRankOwner_) {
+    if (mpiRank_ == mpiRankOwner_) {
       std::map<std::string, std::shared_ptr<DataContainerBase>>& dataContainers =
                                                             fileData.getData().getContainers();
       for (auto& dataPair : dataContainers) {
@@ -263,10 +395,9 @@ size_t monio::Reader::findTimeStep(const FileData& fileData, const util::DateTim
     utils::throwException("Reader::findTimeStep()> Date times not initialised...");
   }
 
-  for (size_t timeStep = 0; timeStep < fileData.getDateTimes().size(); ++timeStep) {
-    if (fileData.getDateTimes()[timeStep] == dateTime) {
-      return timeStep;
-    }
+  auto it = fileData.getTimeSteps().find(dateTime.toString());
+  if (it != fileData.getTimeSteps().end()) {
+    return it->second;
   }
 
   // Otherwise - time not found in the file. Throw a descriptive error.
@@ -63,18 +63,43 @@ class Reader {
                       const size_t timeStep,
                       const std::string& timeDimName);
 
+  /// \brief Reads a block of levels of a single variable at numTimes consecutive time steps, with
+  ///        one hyperslab. Returns the data of each time step in turn. Variables without a time
+  ///        dimension are read once and their data returned for every time. Levels are the
+  ///        slowest-varying dimension other than time. The returned data are not added to the file
+  ///        data.
+  std::vector<std::shared_ptr<DataContainerBase>> readDatumLevels(const FileData& fileData,
+                                                                  const std::string& varName,
+                                                                  const size_t timeStep,
+                                                                  const size_t numTimes,
+                                                                  const std::string& timeDimName,
+                                                                  const size_t levelStart,
+                                                                  const size_t numLevels);
+
   /// \brief Copies of coordinate data from the set of populated data containers.
   std::vector<std::shared_ptr<DataContainerBase>> getCoordData(FileData& fileData,
                                                   const std::vector<std::string>& coordNames);
 
- private:
   /// \brief Converts a date-time into a time step.
   size_t findTimeStep(const FileData& fileData, const util::DateTime& dateTime);
 
+ private:
   File& getFile();
 
+  /// \brief Reads a hyperslab of a variable into containers of type C, split into numSlices
+  ///        slices of equal size along its slowest-varying dimension.
+  template<typename C, typename T> void readDatumSlices(
+                        const std::string& varName,
+                        const std::vector<size_t>& startVec,
+                        const std::vector<size_t>& countVec,
+                        const size_t numSlices,
+                        std::vector<std::shared_ptr<DataContainerBase>>& dataContainers);
+
   const eckit::mpi::Comm& mpiCommunicator_;
   const std::size_t mpiRankOwner_;
+  /// \brief Found on construction, so that reads on the I/O thread of ReadPipeline make no MPI
+  ///        calls.
+  const std::size_t mpiRank_;
 
   std::unique_ptr<File> file_;
 };
@@ -12,8 +12,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <fstream>
+#include <limits>
 #include <memory>
+#include <type_traits>
 
 #include "AttributeBase.h"
 #include "DataContainerBase.h"
@@ -23,6 +26,11 @@
 
 #include "oops/util/Logger.h"
 
+namespace  {
+  /// \brief Set on background threads, whose errors are rethrown on the thread that started them.
+  thread_local bool isBackgroundThread_ = false;
+}  // namespace
+
 namespace monio {
 namespace utils {
 std::vector<std::string> strToWords(const std::string inputStr,
@@ -63,6 +71,20 @@ bool strToBool(std::string input) {
   }
 }
 
+int strToDataType(std::string input) {
+  std::string cleanStr = strNoWhiteSpace(strTolower(input));
+  if (cleanStr == "default") {
+    return -1;
+  }
+  for (int dataType = 0; dataType < consts::eNumberOfDataTypes; ++dataType) {
+    if (cleanStr == consts::kDataTypeNames[dataType]) {
+      return dataType;
+    }
+  }
+  throw std::invalid_argument("utils::strToDataType> Input value of \"" + input +
+                              "\" is not valid.");
+}
+
 std::string exec(const std::string& cmd) {
   std::array<char, 128> buffer;
   std::string result;
@@ -123,11 +145,89 @@ bool findInVector(std::vector<T> vector, T searchTerm) {
 }
 
 template bool findInVector<std::string>(std::vector<std::string> vector, std::string searchTerm);
+template bool findInVector<std::size_t>(std::vector<std::size_t> vector, std::size_t searchTerm);
+
+template<typename T>
+void unpackData(std::vector<T>& dataVec, const consts::Packing& packing) {
+  unpackData(dataVec.data(), dataVec.size(), packing);
+}
+
+template void unpackData<double>(std::vector<double>& dataVec, const consts::Packing& packing);
+template void unpackData<float>(std::vector<float>& dataVec, const consts::Packing& packing);
+template void unpackData<int>(std::vector<int>& dataVec, const consts::Packing& packing);
+
+template<typename T>
+void unpackData(T* data, const std::size_t numValues, const consts::Packing& packing) {
+  for (std::size_t i = 0; i < numValues; ++i) {
+    if (std::is_floating_point<T>::value == true && data[i] == packing.fillValue) {
+      data[i] = std::numeric_limits<T>::quiet_NaN();
+    } else {
+      data[i] = static_cast<T>((data[i] * packing.scaleFactor) + packing.addOffset);
+    }
+  }
+}
+
+template void unpackData<double>(double* data, const std::size_t numValues,
+                                 const consts::Packing& packing);
+template void unpackData<float>(float* data, const std::size_t numValues,
+                                const consts::Packing& packing);
+template void unpackData<int>(int* data, const std::size_t numValues,
+                              const consts::Packing& packing);
+
+template<typename T>
+std::size_t packData(std::vector<T>& dataVec, const consts::Packing& packing) {
+  std::size_t numClamped = 0;
+  for (auto& value : dataVec) {
+    // NaN would otherwise pass the range check below and be rejected by NetCDF as out of range
+    if (std::isnan(static_cast<double>(value)) == true) {
+      value = static_cast<T>(packing.fillValue);
+      continue;
+    }
+    double packedValue = std::round((value - packing.addOffset) / packing.scaleFactor);
+    if (std::abs(packedValue) > packing.packedMax) {
+      packedValue = std::copysign(packing.packedMax, packedValue);
+      numClamped++;
+    }
+    value = static_cast<T>(packedValue);
+  }
+  return numClamped;
+}
+
+template std::size_t packData<double>(std::vector<double>& dataVec,
+                                      const consts::Packing& packing);
+template std::size_t packData<float>(std::vector<float>& dataVec,
+                                     const consts::Packing& packing);
+template std::size_t packData<int>(std::vector<int>& dataVec,
+                                   const consts::Packing& packing);
+
+consts::LevelRemap getLevelRemap(const bool isLfricConvention,
+                                 const bool noFirstLevel,
+                                 const std::size_t numLevels) {
+  consts::LevelRemap levelRemap;
+  if (isLfricConvention == true && noFirstLevel == true &&
+      numLevels == consts::kVerticalHalfSize) {
+    levelRemap.levelOffset = 1;
+    levelRemap.isSurfaceCopied = true;
+  }
+  return levelRemap;
+}
+
+void setBackgroundThread() {
+  isBackgroundThread_ = true;
+}
+
+bool isBackgroundThread() {
+  return isBackgroundThread_;
+}
 
 void throwException(const std::string message) {
-  oops::Log::error() << message << std::endl;
-  // Call MPI abort on the WORLD communicator.
-  eckit::mpi::comm("world").abort();
+  // Background threads make no MPI calls. The error is logged and all PEs are aborted where it is
+  // rethrown on the main thread.
+  if (isBackgroundThread_ == false) {
+    oops::Log::error() << message << std::endl;
+    // Call MPI abort on the WORLD communicator.
+    eckit::mpi::comm("world").abort();
+  }
   throw std::runtime_error(message);
 }
 }  // namespace utils
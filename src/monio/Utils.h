@@ -15,6 +15,8 @@
 #include <string>
 #include <vector>
 
+#include "Constants.h"
+
 namespace monio {
 /// \brief Contains general helper functions
 namespace utils {
@@ -25,6 +27,9 @@ namespace utils {
   std::string strTolower(std::string input);
 
   bool strToBool(std::string input);
+  /// \brief Returns the value of eDataTypes named by a string, as in kDataTypeNames. "default"
+  ///        returns -1, as for FieldMetadata.outputType where a field's own type is written.
+  int strToDataType(std::string input);
   bool fileExists(std::string path);
 
   std::string exec(const std::string& cmd);
@@ -38,6 +43,36 @@ namespace utils {
   template<typename T>
   bool findInVector(std::vector<T> vector, T searchTerm);
 
+  /// \brief Converts CF-packed values to unpacked values, in place. Fill values are unpacked to
+  ///        NaN where T is a floating-point type.
+  template<typename T>
+  void unpackData(std::vector<T>& dataVec, const consts::Packing& packing);
+
+  /// \brief As above, for numValues values from data.
+  template<typename T>
+  void unpackData(T* data, const std::size_t numValues, const consts::Packing& packing);
+
+  /// \brief Converts values to CF-packed values, in place. Packed values are rounded to whole
+  ///        numbers, and are converted to the packed type by NetCDF as they are written. Values
+  ///        outside the range of the packed type, as where appended states exceed the range of the
+  ///        first, are clamped to +/- packedMax. NaN values are packed as the fill value. Returns
+  ///        the number of values clamped.
+  template<typename T>
+  std::size_t packData(std::vector<T>& dataVec, const consts::Packing& packing);
+
+  /// \brief Returns the level remap of a field. LFRic fields without a first level hold one level
+  ///        fewer than their variables, whose zeroth level is a copy of the first.
+  consts::LevelRemap getLevelRemap(const bool isLfricConvention,
+                                   const bool noFirstLevel,
+                                   const std::size_t numLevels);
+
+  /// \brief Marks the calling thread as a background thread of MONIO. Applies to that thread only.
+  void setBackgroundThread();
+  /// \brief Returns true where the calling thread has been marked by setBackgroundThread.
+  bool isBackgroundThread();
+
+  /// \brief Logs an error and aborts all PEs, then throws. On background threads, which make no
+  ///        MPI calls, the error is only thrown, to be rethrown on the main thread.
   [[noreturn]] void throwException(const std::string message);
 }  // namespace utils
 }  // namespace monio
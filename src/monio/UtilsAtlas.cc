@@ -9,7 +9,11 @@
 #include "UtilsAtlas.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <numeric>
+#include <utility>
 
 #include "atlas/functionspace.h"
 #include "atlas/grid/Iterator.h"
@@ -22,6 +26,38 @@
 #include "Monio.h"
 #include "Utils.h"
 
+namespace  {
+  /// \brief Straight-line distance between two points on the unit sphere. Inputs are in degrees.
+  double chordDistance(const atlas::PointLonLat& a, const atlas::PointLonLat& b) {
+    const double degToRad = M_PI / 180.;
+    const double aLon = a.lon() * degToRad, aLat = a.lat() * degToRad;
+    const double bLon = b.lon() * degToRad, bLat = b.lat() * degToRad;
+    const double dx = std::cos(aLat) * std::cos(aLon) - std::cos(bLat) * std::cos(bLon);
+    const double dy = std::cos(aLat) * std::sin(aLon) - std::cos(bLat) * std::sin(bLon);
+    const double dz = std::sin(aLat) - std::sin(bLat);
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+
+  /// \brief Updates the minimum and maximum with the values of nodes that are not ghosts.
+  template<typename T>
+  void updateRange(const atlas::Field& field, const atlas::Field& ghostField,
+                   double& minValue, double& maxValue) {
+    auto fieldView = atlas::array::make_view<const T, 2>(field);
+    auto ghostView = atlas::array::make_view<const int, 1>(ghostField);
+    for (atlas::idx_t i = 0; i < field.shape(monio::consts::eHorizontal); ++i) {
+      if (ghostView(i) == 0) {
+        for (atlas::idx_t j = 0; j < field.shape(monio::consts::eVertical); ++j) {
+          const double value = static_cast<double>(fieldView(i, j));
+          if (std::isnan(value) == false) {  // Written as fill values, so not in the range
+            minValue = std::min(minValue, value);
+            maxValue = std::max(maxValue, value);
+          }
+        }
+      }
+    }
+  }
+}  // namespace
+
 namespace monio {
 namespace utilsatlas {
 std::vector<atlas::PointLonLat> getLfricCoords(
@@ -97,15 +133,117 @@ std::vector<std::shared_ptr<monio::DataContainerBase>> convertLatLonToContainers
   return coordContainers;
 }
 
-std::vector<size_t> createLfricAtlasMap(const std::vector<atlas::PointLonLat>& atlasCoords,
-                                        const std::vector<atlas::PointLonLat>& lfricCoords) {
-  std::vector<size_t> lfricAtlasMap;
+void checkLfricAtlasCoords(const std::vector<atlas::PointLonLat>& atlasCoords,
+                           const std::vector<atlas::PointLonLat>& lfricCoords) {
   // Essential check to ensure grid is configured to accommodate the data
   if (atlasCoords.size() != lfricCoords.size()) {
     Monio::get().closeFiles();
-    utils::throwException("utilsatlas::createLfricAtlasMap()> "
+    utils::throwException("utilsatlas::checkLfricAtlasCoords()> "
       "Configured grid is not compatible with input file...");
   }
+  if (atlasCoords.size() > std::numeric_limits<uint32_t>::max()) {
+    Monio::get().closeFiles();
+    utils::throwException("utilsatlas::checkLfricAtlasCoords()> "
+      "Grid size exceeds the range of the map index type...");
+  }
+}
+
+std::vector<uint32_t> createLfricAtlasMap(const std::vector<atlas::PointLonLat>& atlasCoords,
+                                          const std::vector<atlas::PointLonLat>& lfricCoords) {
+  checkLfricAtlasCoords(atlasCoords, lfricCoords);
+  std::vector<uint32_t> lfricAtlasMap;
+  if (createCubedSphereLfricAtlasMap(atlasCoords, lfricCoords, lfricAtlasMap) == false) {
+    lfricAtlasMap = createKDTreeLfricAtlasMap(atlasCoords, lfricCoords);
+  }
+  return lfricAtlasMap;
+}
+
+bool createCubedSphereLfricAtlasMap(const std::vector<atlas::PointLonLat>& atlasCoords,
+                                    const std::vector<atlas::PointLonLat>& lfricCoords,
+                                    std::vector<uint32_t>& lfricAtlasMap) {
+  const size_t size = atlasCoords.size();
+  const size_t n = std::lround(std::sqrt(size / static_cast<double>(consts::kCubedSphereTiles)));
+  const size_t tileSize = n * n;
+  if (n == 0 || consts::kCubedSphereTiles * tileSize != size || lfricCoords.size() != size) {
+    return false;
+  }
+  // Points are matched if closer than a quarter of the spacing between cell centres.
+  const double tolerance = 0.25 * (M_PI / 2.) / n;
+  auto isClose = [&](const atlas::PointLonLat& a, const atlas::PointLonLat& b) {
+    return chordDistance(a, b) < tolerance;
+  };
+  // Maps a position (i, j) on an LFRic panel to one on an Atlas tile via one of the eight
+  // symmetries of the square. Bit 0 transposes, bit 1 reverses i and bit 2 reverses j.
+  auto transform = [n](const int orientation, const size_t i, const size_t j) {
+    size_t ti = (orientation & 1) ? j : i;
+    size_t tj = (orientation & 1) ? i : j;
+    ti = (orientation & 2) ? n - 1 - ti : ti;
+    tj = (orientation & 4) ? n - 1 - tj : tj;
+    return std::make_pair(ti, tj);
+  };
+  // Corners of a panel distinguish all eight symmetries. The centre is an additional check.
+  const std::array<std::pair<size_t, size_t>, 5> samplePositions{{
+      {0, 0}, {n - 1, 0}, {0, n - 1}, {n - 1, n - 1}, {n / 2, n / 2}}};
+
+  std::array<int, consts::kCubedSphereTiles> panelTiles;
+  std::array<int, consts::kCubedSphereTiles> panelOrientations;
+  std::array<bool, consts::kCubedSphereTiles> isTileMatched{};
+  for (int panel = 0; panel < consts::kCubedSphereTiles; ++panel) {
+    panelTiles[panel] = -1;
+    for (int tile = 0; tile < consts::kCubedSphereTiles && panelTiles[panel] == -1; ++tile) {
+      if (isTileMatched[tile] == true) {
+        continue;
+      }
+      for (int orientation = 0; orientation < 8; ++orientation) {
+        bool isMatch = true;
+        for (const auto& position : samplePositions) {
+          auto tilePosition = transform(orientation, position.first, position.second);
+          size_t lfricIndex = (panel * tileSize) + (position.second * n) + position.first;
+          size_t atlasIndex = (tile * tileSize) + (tilePosition.second * n) + tilePosition.first;
+          if (isClose(lfricCoords[lfricIndex], atlasCoords[atlasIndex]) == false) {
+            isMatch = false;
+            break;
+          }
+        }
+        if (isMatch == true) {
+          panelTiles[panel] = tile;
+          panelOrientations[panel] = orientation;
+          isTileMatched[tile] = true;
+          break;
+        }
+      }
+    }
+    if (panelTiles[panel] == -1) {
+      return false;  // Unknown ordering
+    }
+  }
+  // Generate the full map in closed form
+  lfricAtlasMap.resize(size);
+  for (int panel = 0; panel < consts::kCubedSphereTiles; ++panel) {
+    const size_t panelOffset = panel * tileSize;
+    const size_t tileOffset = panelTiles[panel] * tileSize;
+    for (size_t j = 0; j < n; ++j) {
+      for (size_t i = 0; i < n; ++i) {
+        auto tilePosition = transform(panelOrientations[panel], i, j);
+        lfricAtlasMap[panelOffset + (j * n) + i] =
+            tileOffset + (tilePosition.second * n) + tilePosition.first;
+      }
+    }
+  }
+  // Verify against an evenly-spaced sample of all coordinates
+  const size_t stride = std::max<size_t>(1, size / consts::kMapVerificationSamples);
+  for (size_t lfricIndex = 0; lfricIndex < size; lfricIndex += stride) {
+    if (isClose(lfricCoords[lfricIndex], atlasCoords[lfricAtlasMap[lfricIndex]]) == false) {
+      lfricAtlasMap.clear();
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<uint32_t> createKDTreeLfricAtlasMap(const std::vector<atlas::PointLonLat>& atlasCoords,
+                                          const std::vector<atlas::PointLonLat>& lfricCoords) {
+  std::vector<uint32_t> lfricAtlasMap;
   lfricAtlasMap.reserve(atlasCoords.size());
 
   // Make a kd-tree using atlasLonLat as the point,
@@ -117,9 +255,6 @@ std::vector<size_t> createLfricAtlasMap(const std::vector<atlas::PointLonLat>& a
   atlas::util::IndexKDTree tree(unitSphere);
   tree.build(atlasCoords, indices);
 
-  // Partitioning vector to create atlas::Distribution for mesh generation
-  std::vector<int> partitioning(tree.size(), -1);
-
   // find atlas global indices for each element of modelLonLat
   for (const auto& lfricCoord : lfricCoords) {
     auto idx = tree.closestPoint(lfricCoord).payload();
@@ -128,14 +263,14 @@ std::vector<size_t> createLfricAtlasMap(const std::vector<atlas::PointLonLat>& a
   return lfricAtlasMap;
 }
 
-atlas::Field getGlobalField(const atlas::Field& field) {
+atlas::Field getGlobalField(const atlas::Field& field, const int ownerRank) {
   if (field.metadata().get<bool>("global") == false) {
     atlas::array::DataType atlasType = field.datatype();
     atlas::idx_t numLevels = field.shape(consts::eVertical);
     atlas::util::Config atlasOptions = atlas::option::name(field.name()) |
                                        atlas::option::levels(numLevels) |
                                        atlas::option::datatype(atlasType) |
-                                       atlas::option::global(0);
+                                       atlas::option::global(ownerRank);
     if (atlasType != atlasType.KIND_REAL64 &&
         atlasType != atlasType.KIND_REAL32 &&
         atlasType != atlasType.KIND_INT32) {
@@ -187,6 +322,51 @@ atlas::idx_t getGlobalDataSize(const atlas::Field& field) {
   return size;
 }
 
+void getOwnedNodes(const atlas::Field& field,
+                   std::vector<atlas::idx_t>& nodeIndices,
+                   std::vector<int>& globalIndices) {
+  oops::Log::trace() << "utilsatlas::getOwnedNodes()" << std::endl;
+  const auto& functionSpace = field.functionspace();
+  atlas::Field ghostField = functionSpace.ghost();
+  atlas::Field globalIndexField = functionSpace.global_index();
+  auto ghostView = atlas::array::make_view<int, 1>(ghostField);
+  auto globalIndexView = atlas::array::make_view<atlas::gidx_t, 1>(globalIndexField);
+  nodeIndices.clear();
+  globalIndices.clear();
+  for (atlas::idx_t i = 0; i < ghostField.size(); ++i) {
+    if (ghostView(i) == 0) {
+      nodeIndices.push_back(i);
+      globalIndices.push_back(globalIndexView(i) - 1);  // Atlas global indices start at 1
+    }
+  }
+}
+
+std::pair<double, double> getFieldRange(const atlas::Field& field,
+                                        const eckit::mpi::Comm& mpiCommunicator) {
+  oops::Log::trace() << "utilsatlas::getFieldRange()" << std::endl;
+  double minValue = std::numeric_limits<double>::max();
+  double maxValue = std::numeric_limits<double>::lowest();
+  atlas::Field ghostField = field.functionspace().ghost();
+  atlas::array::DataType atlasType = field.datatype();
+  switch (atlasType.kind()) {
+    case atlasType.KIND_REAL64: {
+      updateRange<double>(field, ghostField, minValue, maxValue);
+      break;
+    }
+    case atlasType.KIND_REAL32: {
+      updateRange<float>(field, ghostField, minValue, maxValue);
+      break;
+    }
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("utilsatlas::getFieldRange()> Data type not coded for...");
+    }
+  }
+  mpiCommunicator.allReduceInPlace(minValue, eckit::mpi::min());
+  mpiCommunicator.allReduceInPlace(maxValue, eckit::mpi::max());
+  return {minValue, maxValue};
+}
+
 int atlasTypeToMonioEnum(atlas::array::DataType atlasType) {
   switch (atlasType.kind()) {
     case atlasType.KIND_INT32: {
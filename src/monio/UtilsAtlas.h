@@ -8,9 +8,11 @@
 ******************************************************************************/
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "atlas/array/DataType.h"
@@ -36,16 +38,49 @@ namespace utilsatlas {
                                         const std::vector<atlas::PointLonLat>& atlasCoords,
                                         const std::vector<std::string>& coordNames);
 
-  std::vector<size_t> createLfricAtlasMap(const std::vector<atlas::PointLonLat>& atlasCoords,
-                                          const std::vector<atlas::PointLonLat>& lfricCoords);
+  /// \brief Throws where coordinates cannot be mapped, as their numbers differ or exceed the range
+  ///        of the map index type.
+  void checkLfricAtlasCoords(const std::vector<atlas::PointLonLat>& atlasCoords,
+                             const std::vector<atlas::PointLonLat>& lfricCoords);
+
+  /// \brief Returns a map from LFRic to Atlas horizontal indices. The cubed-sphere map is
+  ///        generated in closed form where possible, otherwise a nearest-neighbour search is used.
+  std::vector<uint32_t> createLfricAtlasMap(const std::vector<atlas::PointLonLat>& atlasCoords,
+                                            const std::vector<atlas::PointLonLat>& lfricCoords);
+
+  /// \brief Generates the map in O(N) where both orderings are panel-major with cells ordered by
+  ///        row on each panel. The rotation and reflection of each panel is found from its corners
+  ///        and the result is verified against a sample of coordinates. Returns false otherwise.
+  bool createCubedSphereLfricAtlasMap(const std::vector<atlas::PointLonLat>& atlasCoords,
+                                      const std::vector<atlas::PointLonLat>& lfricCoords,
+                                      std::vector<uint32_t>& lfricAtlasMap);
+
+  /// \brief Generates the map with a KD-tree nearest-neighbour search. Works for any ordering.
+  std::vector<uint32_t> createKDTreeLfricAtlasMap(
+                                            const std::vector<atlas::PointLonLat>& atlasCoords,
+                                            const std::vector<atlas::PointLonLat>& lfricCoords);
 
   atlas::FieldSet getGlobalFieldSet(const atlas::FieldSet& fieldSet);
 
-  atlas::Field getGlobalField(const atlas::Field& field);
+  /// \brief Gathers a field onto the given PE. Fields that are already global are returned as-is.
+  atlas::Field getGlobalField(const atlas::Field& field,
+                              const int ownerRank = consts::kMPIRankOwner);
 
   atlas::idx_t getHorizontalSize(const atlas::Field& field);  // Just 2D size. Any field.
   atlas::idx_t getGlobalDataSize(const atlas::Field& field);  // Full 3D size of global field.
 
+  /// \brief Finds the local indices of the nodes owned by this PE, with their zero-based global
+  ///        indices. Halo nodes are excluded.
+  void getOwnedNodes(const atlas::Field& field,
+                     std::vector<atlas::idx_t>& nodeIndices,
+                     std::vector<int>& globalIndices);
+
+  /// \brief Returns the minimum and maximum of the owned values of a floating-point field across
+  ///        all PEs, excluding NaN. The minimum exceeds the maximum where there are no other
+  ///        values. Collective.
+  std::pair<double, double> getFieldRange(const atlas::Field& field,
+                                          const eckit::mpi::Comm& mpiCommunicator);
+
   int atlasTypeToMonioEnum(atlas::array::DataType atlasType);
 
   bool compareFieldSets(const atlas::FieldSet& aSet, const atlas::FieldSet& bSet);
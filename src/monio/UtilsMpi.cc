@@ -0,0 +1,47 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "UtilsMpi.h"
+
+#include "Constants.h"
+#include "Monio.h"
+#include "Utils.h"
+
+namespace monio {
+namespace utilsmpi {
+MPI_Datatype getMpiDataType(const int dataType) {
+  switch (dataType) {
+    case consts::eDataTypes::eDouble:
+      return MPI_DOUBLE;
+    case consts::eDataTypes::eFloat:
+      return MPI_FLOAT;
+    case consts::eDataTypes::eInt:
+      return MPI_INT;
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("utilsmpi::getMpiDataType()> Data type not coded for...");
+    }
+  }
+}
+
+std::size_t getDataTypeSize(const int dataType) {
+  switch (dataType) {
+    case consts::eDataTypes::eDouble:
+      return sizeof(double);
+    case consts::eDataTypes::eFloat:
+      return sizeof(float);
+    case consts::eDataTypes::eInt:
+      return sizeof(int);
+    default: {
+      Monio::get().closeFiles();
+      utils::throwException("utilsmpi::getDataTypeSize()> Data type not coded for...");
+    }
+  }
+}
+}  // namespace utilsmpi
+}  // namespace monio
@@ -0,0 +1,24 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <mpi.h>
+
+#include <cstddef>
+
+namespace monio {
+/// \brief Contains helper functions for calls made directly to the MPI C API.
+namespace utilsmpi {
+  /// \brief Returns the MPI data type of a MONIO data type.
+  MPI_Datatype getMpiDataType(const int dataType);
+
+  /// \brief Returns the size in bytes of a MONIO data type.
+  std::size_t getDataTypeSize(const int dataType);
+}  // namespace utilsmpi
+}  // namespace monio
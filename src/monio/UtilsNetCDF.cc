@@ -0,0 +1,47 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "UtilsNetCDF.h"
+
+#include <netcdf.h>
+
+#include <string>
+
+#include "Monio.h"
+#include "Utils.h"
+
+namespace monio {
+namespace utilsnetcdf {
+void checkStatus(const int status, const std::string& message) {
+  if (status != NC_NOERR) {
+    Monio::get().closeFiles();
+    utils::throwException(message + std::string(nc_strerror(status)));
+  }
+}
+
+bool getPacking(const int ncId, const int varId, consts::Packing& packing) {
+  nc_type varType;
+  checkStatus(nc_inq_vartype(ncId, varId, &varType), "utilsnetcdf::getPacking()> ");
+  if (varType != NC_SHORT && varType != NC_BYTE) {
+    return false;
+  }
+  packing = consts::Packing();
+  packing.packedMax = varType == NC_SHORT ? consts::kPackedShortMax : consts::kPackedByteMax;
+  packing.fillValue = varType == NC_SHORT ? consts::kPackedShortFill : consts::kPackedByteFill;
+  const std::string scaleFactorName(consts::kScaleFactorName);
+  const std::string addOffsetName(consts::kAddOffsetName);
+  const std::string fillValueName(consts::kFillValueName);
+  bool isScaled = nc_get_att_double(ncId, varId, scaleFactorName.c_str(),
+                                    &packing.scaleFactor) == NC_NOERR;
+  bool isOffset = nc_get_att_double(ncId, varId, addOffsetName.c_str(),
+                                    &packing.addOffset) == NC_NOERR;
+  nc_get_att_double(ncId, varId, fillValueName.c_str(), &packing.fillValue);
+  return isScaled == true || isOffset == true;
+}
+}  // namespace utilsnetcdf
+}  // namespace monio
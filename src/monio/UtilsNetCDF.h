@@ -0,0 +1,27 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <string>
+
+#include "Constants.h"
+
+namespace monio {
+/// \brief Contains helper functions that use the NetCDF C API. Takes the NetCDF IDs of files, or
+///        groups, and of variables, so as to serve both File and the parallel reader and writer.
+namespace utilsnetcdf {
+  /// \brief Throws where the status returned by a NetCDF call is an error, with its message
+  ///        appended to that passed.
+  void checkStatus(const int status, const std::string& message);
+
+  /// \brief Returns true where a variable is CF-packed, with its packing. Where the variable has
+  ///        no _FillValue attribute, the NetCDF default fill value of its type is taken.
+  bool getPacking(const int ncId, const int varId, consts::Packing& packing);
+}  // namespace utilsnetcdf
+}  // namespace monio
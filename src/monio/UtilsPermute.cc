@@ -0,0 +1,240 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "UtilsPermute.h"
+
+#include <algorithm>
+
+#include "Constants.h"
+#include "Monio.h"
+#include "Utils.h"
+
+namespace monio {
+namespace utilspermute {
+void checkFileIndices(const uint32_t* fileIndices,
+                      const std::size_t numNodes,
+                      const std::size_t horizontalSize,
+                      const std::string& caller) {
+  if (numNodes != 0 &&
+      *std::max_element(fileIndices, fileIndices + numNodes) >= horizontalSize) {
+    Monio::get().closeFiles();
+    utils::throwException(caller + "> Calculated index exceeds size of data...");
+  }
+}
+
+// Both kernels work on tiles of consts::kPermuteBlockSize nodes by levels, so that the cache lines
+// of a tile in both layouts remain in cache while it is transposed. Within a tile, data in file
+// order are accessed contiguously where file indices are consecutive.
+template<typename T, typename U>
+void columnsToFileOrder(const T* columns,
+                        const std::size_t columnStride,
+                        const uint32_t* fileIndices,
+                        const std::size_t numNodes,
+                        const std::size_t numLevels,
+                        U* fileData,
+                        const std::size_t horizontalSize,
+                        const consts::LevelRemap& levelRemap) {
+  const std::size_t levelOffset = levelRemap.levelOffset;
+  for (std::size_t nodeStart = 0; nodeStart < numNodes; nodeStart += consts::kPermuteBlockSize) {
+    const std::size_t nodeEnd = std::min(nodeStart + consts::kPermuteBlockSize, numNodes);
+    for (std::size_t levelStart = 0; levelStart < numLevels;
+         levelStart += consts::kPermuteBlockSize) {
+      const std::size_t levelEnd = std::min(levelStart + consts::kPermuteBlockSize, numLevels);
+      for (std::size_t j = levelStart; j < levelEnd; ++j) {
+        U* levelData = fileData + ((j + levelOffset) * horizontalSize);
+        const T* columnData = columns + j;
+        for (std::size_t node = nodeStart; node < nodeEnd; ++node) {
+          levelData[fileIndices[node]] = static_cast<U>(columnData[node * columnStride]);
+        }
+      }
+      // Copies of the surface level are placed while its tile is in cache
+      if (levelStart == 0 && levelRemap.isSurfaceCopied == true) {
+        for (std::size_t j = 0; j < levelOffset; ++j) {
+          U* levelData = fileData + (j * horizontalSize);
+          for (std::size_t node = nodeStart; node < nodeEnd; ++node) {
+            levelData[fileIndices[node]] = static_cast<U>(columns[node * columnStride]);
+          }
+        }
+      }
+    }
+  }
+}
+
+template void columnsToFileOrder<double, double>(const double* columns,
+                                        const std::size_t columnStride,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        double* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap);
+template void columnsToFileOrder<double, float>(const double* columns,
+                                        const std::size_t columnStride,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        float* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap);
+template void columnsToFileOrder<double, int>(const double* columns,
+                                        const std::size_t columnStride,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        int* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap);
+template void columnsToFileOrder<float, double>(const float* columns,
+                                        const std::size_t columnStride,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        double* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap);
+template void columnsToFileOrder<float, float>(const float* columns,
+                                        const std::size_t columnStride,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        float* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap);
+template void columnsToFileOrder<float, int>(const float* columns,
+                                        const std::size_t columnStride,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        int* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap);
+template void columnsToFileOrder<int, double>(const int* columns,
+                                        const std::size_t columnStride,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        double* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap);
+template void columnsToFileOrder<int, float>(const int* columns,
+                                        const std::size_t columnStride,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        float* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap);
+template void columnsToFileOrder<int, int>(const int* columns,
+                                        const std::size_t columnStride,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        int* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap);
+
+template<typename T, typename U>
+void fileOrderToColumns(const T* fileData,
+                        const std::size_t horizontalSize,
+                        const consts::LevelRemap& levelRemap,
+                        const uint32_t* fileIndices,
+                        const std::size_t numNodes,
+                        const std::size_t numLevels,
+                        U* columns,
+                        const std::size_t columnStride) {
+  const std::size_t levelOffset = levelRemap.levelOffset;
+  for (std::size_t nodeStart = 0; nodeStart < numNodes; nodeStart += consts::kPermuteBlockSize) {
+    const std::size_t nodeEnd = std::min(nodeStart + consts::kPermuteBlockSize, numNodes);
+    for (std::size_t levelStart = 0; levelStart < numLevels;
+         levelStart += consts::kPermuteBlockSize) {
+      const std::size_t levelEnd = std::min(levelStart + consts::kPermuteBlockSize, numLevels);
+      for (std::size_t j = levelStart; j < levelEnd; ++j) {
+        const T* levelData = fileData + ((j + levelOffset) * horizontalSize);
+        U* columnData = columns + j;
+        for (std::size_t node = nodeStart; node < nodeEnd; ++node) {
+          columnData[node * columnStride] = static_cast<U>(levelData[fileIndices[node]]);
+        }
+      }
+    }
+  }
+}
+
+template void fileOrderToColumns<double, double>(const double* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        double* columns,
+                                        const std::size_t columnStride);
+template void fileOrderToColumns<double, float>(const double* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        float* columns,
+                                        const std::size_t columnStride);
+template void fileOrderToColumns<double, int>(const double* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        int* columns,
+                                        const std::size_t columnStride);
+template void fileOrderToColumns<float, double>(const float* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        double* columns,
+                                        const std::size_t columnStride);
+template void fileOrderToColumns<float, float>(const float* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        float* columns,
+                                        const std::size_t columnStride);
+template void fileOrderToColumns<float, int>(const float* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        int* columns,
+                                        const std::size_t columnStride);
+template void fileOrderToColumns<int, double>(const int* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        double* columns,
+                                        const std::size_t columnStride);
+template void fileOrderToColumns<int, float>(const int* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        float* columns,
+                                        const std::size_t columnStride);
+template void fileOrderToColumns<int, int>(const int* fileData,
+                                        const std::size_t horizontalSize,
+                                        const consts::LevelRemap& levelRemap,
+                                        const uint32_t* fileIndices,
+                                        const std::size_t numNodes,
+                                        const std::size_t numLevels,
+                                        int* columns,
+                                        const std::size_t columnStride);
+}  // namespace utilspermute
+}  // namespace monio
@@ -0,0 +1,55 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Constants.h"
+
+namespace monio {
+/// \brief Contains the kernels that reorder data between columns, held node by node as in Atlas,
+///        and file order, held level by level as in LFRic files. Callers validate indices once
+///        with checkFileIndices, so the kernels carry no per-element checks. Data are converted
+///        from type T to type U as they are reordered.
+namespace utilspermute {
+  /// \brief Throws where any file index lies outside the horizontal dimension of the file.
+  void checkFileIndices(const uint32_t* fileIndices,
+                        const std::size_t numNodes,
+                        const std::size_t horizontalSize,
+                        const std::string& caller);
+
+  /// \brief Places the columns of numNodes nodes, each starting columnStride elements after the
+  ///        last, at fileIndices in data held in file order, on the file levels given by the
+  ///        level remap. Copies of the surface level are placed in the same pass.
+  template<typename T, typename U>
+  void columnsToFileOrder(const T* columns,
+                          const std::size_t columnStride,
+                          const uint32_t* fileIndices,
+                          const std::size_t numNodes,
+                          const std::size_t numLevels,
+                          U* fileData,
+                          const std::size_t horizontalSize,
+                          const consts::LevelRemap& levelRemap);
+
+  /// \brief Takes the columns of numNodes nodes from fileIndices in data held in file order, from
+  ///        the file levels given by the level remap, and places each columnStride elements after
+  ///        the last.
+  template<typename T, typename U>
+  void fileOrderToColumns(const T* fileData,
+                          const std::size_t horizontalSize,
+                          const consts::LevelRemap& levelRemap,
+                          const uint32_t* fileIndices,
+                          const std::size_t numNodes,
+                          const std::size_t numLevels,
+                          U* columns,
+                          const std::size_t columnStride);
+}  // namespace utilspermute
+}  // namespace monio
@@ -37,6 +37,14 @@ const size_t monio::Variable::getTotalSize() const {
   return totalSize;
 }
 
+const monio::consts::StorageOptions& monio::Variable::getStorageOptions() const {
+  return storageOptions_;
+}
+
+void monio::Variable::setStorageOptions(const consts::StorageOptions& storageOptions) {
+  storageOptions_ = storageOptions;
+}
+
 std::vector<std::pair<std::string, size_t>>& monio::Variable::getDimensionsMap() {
   return dimensions_;
 }
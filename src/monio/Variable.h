@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "AttributeBase.h"
+#include "Constants.h"
 
 namespace monio {
 /// \brief Used by Metadata to hold information about a variable read from
@@ -43,6 +44,10 @@ class Variable {
   std::vector<std::string> getDimensionNames();
   std::map<std::string, std::shared_ptr<AttributeBase>>& getAttributes();
 
+  /// \brief Storage applies to variables in written files only.
+  const consts::StorageOptions& getStorageOptions() const;
+  void setStorageOptions(const consts::StorageOptions& storageOptions);
+
   void addDimension(const std::string& name, const size_t size);
   void addAttribute(std::shared_ptr<monio::AttributeBase> attr);
 
@@ -54,5 +59,6 @@ class Variable {
   int type_;
   std::vector<std::pair<std::string, size_t>> dimensions_;
   std::map<std::string, std::shared_ptr<AttributeBase>> attributes_;
+  consts::StorageOptions storageOptions_;
 };
 }  // namespace monio
@@ -0,0 +1,109 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "WriteBehind.h"
+
+#include "oops/util/Logger.h"
+
+#include "Monio.h"
+#include "Utils.h"
+
+monio::WriteBehind::WriteBehind(const eckit::mpi::Comm& mpiCommunicator,
+                                const int mpiRankOwner) :
+    writer_(mpiCommunicator, mpiRankOwner),
+    isWriting_(false),
+    isStopped_(false) {
+  oops::Log::trace() << "WriteBehind::WriteBehind()" << std::endl;
+}
+
+monio::WriteBehind::~WriteBehind() {
+  // Queued files are written before the thread ends
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopped_ = true;
+  }
+  condition_.notify_all();
+  if (writeThread_.joinable() == true) {
+    writeThread_.join();
+  }
+}
+
+void monio::WriteBehind::push(FileData fileData, const std::string& filePath) {
+  oops::Log::trace() << "WriteBehind::push()" << std::endl;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push_back({std::move(fileData), filePath});
+  }
+  if (writeThread_.joinable() == false) {
+    writeThread_ = std::thread(&WriteBehind::run, this);
+  }
+  condition_.notify_all();
+}
+
+void monio::WriteBehind::wait() {
+  oops::Log::trace() << "WriteBehind::wait()" << std::endl;
+  if (isWriteThread() == true) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  condition_.wait(lock, [this] { return queue_.size() == 0 && isWriting_ == false; });
+  if (exception_ != nullptr) {
+    std::exception_ptr exception = exception_;
+    exception_ = nullptr;
+    lock.unlock();
+    // Files of the calling thread are closed here, rather than by the write thread
+    Monio::get().closeFiles();
+    try {
+      std::rethrow_exception(exception);
+    } catch (const std::exception& writeException) {
+      utils::throwException("WriteBehind::wait()> " + std::string(writeException.what()));
+    }
+  }
+}
+
+bool monio::WriteBehind::isWriteThread() const {
+  return writeThread_.get_id() == std::this_thread::get_id();
+}
+
+void monio::WriteBehind::run() {
+  utils::setBackgroundThread();
+  while (true) {
+    std::pair<FileData, std::string> filePair;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return queue_.size() != 0 || isStopped_ == true; });
+      if (queue_.size() == 0) {
+        return;
+      }
+      filePair = std::move(queue_.front());
+      queue_.pop_front();
+      isWriting_ = true;
+    }
+    try {
+      writer_.openFile(filePair.second);
+      writer_.writeMetadata(filePair.first.getMetadata());
+      writer_.writeData(filePair.first);
+      writer_.closeFile();
+    } catch (...) {
+      // Only the file of this thread is closed. The original error is kept where closure fails.
+      try {
+        writer_.closeFile();
+      } catch (...) {
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (exception_ == nullptr) {
+        exception_ = std::current_exception();
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      isWriting_ = false;
+    }
+    condition_.notify_all();
+  }
+}
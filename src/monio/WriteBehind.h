@@ -0,0 +1,70 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <condition_variable>  // NOLINT(build/c++11)
+#include <deque>
+#include <exception>
+#include <mutex>  // NOLINT(build/c++11)
+#include <string>
+#include <thread>  // NOLINT(build/c++11)
+#include <utility>
+
+#include "eckit/mpi/Comm.h"
+
+#include "FileData.h"
+#include "Writer.h"
+
+namespace monio {
+/// \brief Writes files prepared on the owning PE on a background thread, in the order they are
+///        queued. Each queued FileData holds the complete metadata and data of one file. The thread
+///        is started by the first queued file. It makes no MPI calls, as the Writer finds its rank
+///        on construction and errors on the thread do not abort. Errors on the thread close its
+///        own file only, and are raised on the calling thread by wait(), which aborts as usual.
+class WriteBehind {
+ public:
+  WriteBehind(const eckit::mpi::Comm& mpiCommunicator,
+              const int mpiRankOwner);
+  ~WriteBehind();
+
+  WriteBehind()                               = delete;  //!< Deleted default constructor
+  WriteBehind(WriteBehind&&)                  = delete;  //!< Deleted move constructor
+  WriteBehind(const WriteBehind&)             = delete;  //!< Deleted copy constructor
+  WriteBehind& operator=(WriteBehind&&)       = delete;  //!< Deleted move assignment
+  WriteBehind& operator=(const WriteBehind&)  = delete;  //!< Deleted copy assignment
+
+  /// \brief Queues a file for writing and returns without waiting.
+  void push(FileData fileData, const std::string& filePath);
+
+  /// \brief Waits for all queued files to be written. Raises the first error of a write since
+  ///        the last wait with utils::throwException, once the files of the calling thread are
+  ///        closed. Has no effect where called from the write thread.
+  void wait();
+
+  /// \brief Returns true where called from the write thread.
+  bool isWriteThread() const;
+
+ private:
+  /// \brief Body of the write thread.
+  void run();
+
+  Writer writer_;
+
+  std::thread writeThread_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+
+  /// \brief Files queued but not yet written, with their paths.
+  std::deque<std::pair<FileData, std::string>> queue_;
+  bool isWriting_;
+  bool isStopped_;
+  /// \brief Holds an exception thrown by the write thread until the next wait().
+  std::exception_ptr exception_;
+};
+}  // namespace monio
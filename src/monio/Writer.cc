@@ -11,6 +11,7 @@
 #include <netcdf>
 #include <map>
 #include <stdexcept>
+#include <utility>
 
 #include "Constants.h"
 #include "DataContainerDouble.h"
@@ -24,7 +25,8 @@ monio::Writer::Writer(const eckit::mpi::Comm& mpiCommunicator,
                       const int mpiRankOwner,
                       const std::string& filePath) :
     mpiCommunicator_(mpiCommunicator),
-    mpiRankOwner_(mpiRankOwner) {
+    mpiRankOwner_(mpiRankOwner),
+    mpiRank_(mpiCommunicator.rank()) {
   oops::Log::trace() << "Writer::Writer()" << std::endl;
   openFile(filePath);
 }
@@ -32,16 +34,18 @@ monio::Writer::Writer(const eckit::mpi::Comm& mpiCommunicator,
 monio::Writer::Writer(const eckit::mpi::Comm& mpiCommunicator,
                       const int mpiRankOwner) :
     mpiCommunicator_(mpiCommunicator),
-    mpiRankOwner_(mpiRankOwner) {
+    mpiRankOwner_(mpiRankOwner),
+    mpiRank_(mpiCommunicator.rank()) {
   oops::Log::trace() << "Writer::Writer()" << std::endl;
 }
 
-void monio::Writer::openFile(const std::string& filePath) {
+void monio::Writer::openFile(const std::string& filePath,
+                             const netCDF::NcFile::FileMode fileMode) {
   oops::Log::trace() << "Writer::openFile() \"" << filePath << "\"..." << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     if (filePath.size() != 0) {
       try {
-        file_ = std::make_unique<File>(filePath, netCDF::NcFile::replace);
+        file_ = std::make_unique<File>(filePath, fileMode);
       } catch (netCDF::exceptions::NcException& exception) {
         closeFile();
         utils::throwException("Writer::openFile()> An exception occurred while creating File...");
@@ -52,7 +56,7 @@ void monio::Writer::openFile(const std::string& filePath) {
 
 void monio::Writer::closeFile() {
   oops::Log::trace() << "Writer::closeFile()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     if (isOpen() == true) {
       getFile().close();
       file_.reset();
@@ -66,14 +70,14 @@ bool monio::Writer::isOpen() {
 
 void monio::Writer::writeMetadata(const Metadata& metadata) {
   oops::Log::trace() << "Writer::writeMetadata()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     getFile().writeMetadata(metadata);
   }
 }
 
 void monio::Writer::writeData(const FileData& fileData) {
   oops::Log::trace() << "Writer::writeVariablesData()" << std::endl;
-  if (mpiCommunicator_.rank() == mpiRankOwner_) {
+  if (mpiRank_ == mpiRankOwner_) {
     const std::map<std::string, std::shared_ptr<DataContainerBase>>& dataContainerMap =
                                                                 fileData.getData().getContainers();
     for (const auto& dataContainerPair : dataContainerMap) {
@@ -109,6 +113,77 @@ void monio::Writer::writeData(const FileData& fileData) {
   }
 }
 
+void monio::Writer::writeDatumLevels(const Metadata& metadata,
+                                     const std::shared_ptr<DataContainerBase>& dataContainer,
+                                     const size_t timeStep,
+                                     const std::string& timeDimName,
+                                     const size_t levelStart,
+                                     const size_t numLevels) {
+  oops::Log::trace() << "Writer::writeDatumLevels()" << std::endl;
+  if (mpiRank_ == mpiRankOwner_) {
+    const std::string& varName = dataContainer->getName();
+    std::shared_ptr<Variable> variable = metadata.getVariable(varName);
+    std::vector<std::pair<std::string, size_t>> dimensions = variable->getDimensionsMap();
+    size_t numSpatialDims = 0;
+    for (auto const& dimPair : dimensions) {
+      if (dimPair.first != timeDimName) {
+        numSpatialDims++;
+      }
+    }
+    // Variables without a vertical dimension hold a single level.
+    if (numSpatialDims <= 1 && (levelStart != 0 || numLevels != 1)) {
+      closeFile();
+      utils::throwException("Writer::writeDatumLevels()> Levels written exceed those of \"" +
+                            varName + "\"...");
+    }
+    bool isLevelDim = numSpatialDims > 1;
+    std::vector<size_t> startVec;
+    std::vector<size_t> countVec;
+    for (auto const& dimPair : dimensions) {
+      if (dimPair.first == timeDimName) {
+        startVec.push_back(timeStep);
+        countVec.push_back(1);
+      } else if (isLevelDim == true) {
+        if (levelStart + numLevels > dimPair.second) {
+          closeFile();
+          utils::throwException("Writer::writeDatumLevels()> Levels written exceed those of \"" +
+                                varName + "\"...");
+        }
+        startVec.push_back(levelStart);
+        countVec.push_back(numLevels);
+        isLevelDim = false;
+      } else {
+        startVec.push_back(0);
+        countVec.push_back(dimPair.second);
+      }
+    }
+    switch (dataContainer->getType()) {
+      case consts::eDataTypes::eDouble: {
+        std::shared_ptr<DataContainerDouble> dataContainerDouble =
+            std::static_pointer_cast<DataContainerDouble>(dataContainer);
+        getFile().writeFieldDatum(varName, startVec, countVec, dataContainerDouble->getData());
+        break;
+      }
+      case consts::eDataTypes::eFloat: {
+        std::shared_ptr<DataContainerFloat> dataContainerFloat =
+            std::static_pointer_cast<DataContainerFloat>(dataContainer);
+        getFile().writeFieldDatum(varName, startVec, countVec, dataContainerFloat->getData());
+        break;
+      }
+      case consts::eDataTypes::eInt: {
+        std::shared_ptr<DataContainerInt> dataContainerInt =
+            std::static_pointer_cast<DataContainerInt>(dataContainer);
+        getFile().writeFieldDatum(varName, startVec, countVec, dataContainerInt->getData());
+        break;
+      }
+      default: {
+        closeFile();
+        utils::throwException("Writer::writeDatumLevels()> Data type not coded for...");
+      }
+    }
+  }
+}
+
 monio::File& monio::Writer::getFile() {
   oops::Log::trace() << "Writer::getFile()" << std::endl;
   if (isOpen() == false) {
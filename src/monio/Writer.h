@@ -8,6 +8,8 @@
 ******************************************************************************/
 #pragma once
 
+#include <netcdf>
+
 #include <map>
 #include <memory>
 #include <string>
@@ -17,6 +19,7 @@
 #include "eckit/mpi/Comm.h"
 
 #include "Data.h"
+#include "DataContainerBase.h"
 #include "File.h"
 #include "FileData.h"
 #include "Metadata.h"
@@ -38,18 +41,32 @@ class Writer {
   Writer& operator=(Writer&&)      = delete;  //!< Deleted move assign
   Writer& operator=(const Writer&) = delete;  //!< Deleted copy assign
 
-  void openFile(const std::string& filePath);
+  /// \brief Creates a file, or opens an existing file for writing where fileMode is write.
+  void openFile(const std::string& filePath,
+                const netCDF::NcFile::FileMode fileMode = netCDF::NcFile::replace);
   void closeFile();
   bool isOpen();
 
   void writeMetadata(const Metadata& metadata);
   void writeData(const FileData& fileData);
+  /// \brief Writes a block of levels of a single variable from a data container named after it,
+  ///        at a particular time step where the variable has a time dimension. Levels are the
+  ///        slowest-varying dimension other than time.
+  void writeDatumLevels(const Metadata& metadata,
+                        const std::shared_ptr<DataContainerBase>& dataContainer,
+                        const size_t timeStep,
+                        const std::string& timeDimName,
+                        const size_t levelStart,
+                        const size_t numLevels);
 
  private:
   File& getFile();
 
   const eckit::mpi::Comm& mpiCommunicator_;
   const std::size_t mpiRankOwner_;
+  /// \brief Found on construction, so that writes on the write thread of WriteBehind make no MPI
+  ///        calls.
+  const std::size_t mpiRank_;
 
   std::unique_ptr<File> file_;
 };
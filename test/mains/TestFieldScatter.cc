@@ -0,0 +1,22 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/FieldScatter.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets the distribution of data read in file order to the columns of each PE.
+///        Maps are created under which the owned columns of each PE are contiguous in the file, in
+///        the order of its nodes, and under which they are reversed. Single and multi-level fields
+///        are scattered under each map, whole and in blocks of levels. A test pass is achieved if
+///        each PE holds the file data of its columns, and if the parallel read plan detects
+///        columns held in identity order.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::FieldScatter tests;
+  return run.execute(tests);
+}
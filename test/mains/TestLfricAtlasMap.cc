@@ -0,0 +1,20 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/LfricAtlasMap.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets generation of the map from LFRic to Atlas horizontal indices. The
+///        coordinates of an LFRic file on a cubed-sphere grid are read and mapped in closed form,
+///        then with a KD-tree search. A test pass is achieved if both maps are identical, for the
+///        coordinates as read and in reverse order.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::LfricAtlasMap tests;
+  return run.execute(tests);
+}
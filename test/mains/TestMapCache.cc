@@ -0,0 +1,20 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/MapCache.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets the on-disk cache of LFRic-Atlas maps. A map is stored by one cache and
+///        found on disk by another, then the cache file is modified to have the wrong version, map
+///        size or entries. A test pass is achieved if the map read matches that stored, and if
+///        each modified file is rejected.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::MapCache tests;
+  return run.execute(tests);
+}
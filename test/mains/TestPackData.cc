@@ -0,0 +1,21 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/PackData.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets CF packing of written data and unpacking of read data. Values across a
+///        range are packed and unpacked in memory, then written to, and read from, packed variables
+///        of type short and byte. A test pass is achieved if packed values are whole and within the
+///        range of their type, and if unpacked values are within half a packing interval of those
+///        packed.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::PackData tests;
+  return run.execute(tests);
+}
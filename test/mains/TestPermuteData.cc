@@ -0,0 +1,20 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/PermuteData.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets the kernels that reorder data between columns and file order. Columns
+///        of a subset of nodes, with scattered file indices, are reordered to file order and back,
+///        without a level remap, with a level offset and with a copied surface level. A test pass
+///        is achieved if every element matches a direct calculation.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::PermuteData tests;
+  return run.execute(tests);
+}
@@ -0,0 +1,20 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/StateAppend.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets the writing of a trajectory of states into one file. An input file is
+///        read, and copies of its field set, offset by time step, are appended to an output file
+///        at several date-times. The output file is then read at all date-times with a single call.
+///        A test pass is achieved if the field sets read match those written at each date-time.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::StateAppend tests;
+  return run.execute(tests);
+}
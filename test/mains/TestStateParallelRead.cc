@@ -0,0 +1,20 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/StateParallelRead.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets the alternatives to reading with a single PE. It reads an input file
+///        three times, populating a separate cubed-sphere field set each time: first by the owning
+///        PE alone, then with multiple I/O ranks, and then with parallel NetCDF where each PE reads
+///        its own columns. A test pass is achieved if all three field sets match.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::StateParallelRead tests;
+  return run.execute(tests);
+}
@@ -0,0 +1,20 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/StateReadAhead.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets reads ahead of distribution on a dedicated I/O thread. An input file
+///        is read with no read buffers, so that fields are read as they are distributed, then with
+///        buffers on the owning PE, and with buffers on several I/O ranks. A test pass is achieved
+///        if the field sets of each read match.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::StateReadAhead tests;
+  return run.execute(tests);
+}
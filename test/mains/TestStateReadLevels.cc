@@ -0,0 +1,20 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/StateReadLevels.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets reads of a subset of the levels of each variable, as selected by
+///        FieldMetadata.readLevelStart. Fields are read in full, then surface-only and top-level
+///        fields are read from the same file, serially and with parallel NetCDF. A test pass is
+///        achieved if the latter match the corresponding levels of the former.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::StateReadLevels tests;
+  return run.execute(tests);
+}
@@ -0,0 +1,21 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/StateStorage.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets the storage options of written files. An input file is read and its
+///        field set is written with all fields compressed, one field quantised, and another whose
+///        own options are cleared. A test pass is achieved if the NetCDF library reports the
+///        compression and quantisation of each variable as configured, and if the fields that are
+///        not quantised are read back unchanged.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::StateStorage tests;
+  return run.execute(tests);
+}
@@ -0,0 +1,21 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/StateWindow.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets reads of a state at several date-times, as for the time slots of a 4D
+///        window. A time series of distinct states at consecutive date-times is written to file.
+///        The file is read at each date-time in turn, with a separate call per date-time, then at
+///        all date-times with a single call, with and without reading in blocks of levels. A test
+///        pass is achieved if the field sets of each date-time match those written.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::StateWindow tests;
+  return run.execute(tests);
+}
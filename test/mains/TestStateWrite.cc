@@ -0,0 +1,20 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#include "../monio/StateWrite.h"
+#include "oops/runs/Run.h"
+
+/// \brief This test targets the options with which Monio::writeState writes files. An input file
+///        is read and its field set is written synchronously, asynchronously, in blocks of levels
+///        and in parallel. Each written file is read back and a test pass is achieved if the field
+///        sets read match that written synchronously in serial.
+int main(int argc,  char ** argv) {
+  oops::Run run(argc, argv);
+  monio::test::StateWrite tests;
+  return run.execute(tests);
+}
@@ -0,0 +1,206 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field.h"
+#include "atlas/functionspace/CubedSphereColumns.h"
+#include "atlas/grid/CubedSphereGrid.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/meshgenerator/MeshGenerator.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "eckit/mpi/Buffer.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/Constants.h"
+#include "monio/DataContainerDouble.h"
+#include "monio/FieldScatterer.h"
+#include "monio/ParallelPlan.h"
+#include "monio/Utils.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/Logger.h"
+
+namespace monio {
+namespace test {
+
+atlas::Mesh createMesh(const atlas::CubedSphereGrid& grid,
+                       const std::string& partitionerType,
+                       const std::string& meshType) {
+  oops::Log::debug() << "monio::test::createMesh()" << std::endl;
+  const auto meshConfig = atlas::util::Config("partitioner", partitionerType) |
+                          atlas::util::Config("halo", 0);
+  const auto meshGen = atlas::MeshGenerator(meshType, meshConfig);
+  return meshGen.generate(grid);
+}
+
+atlas::functionspace::CubedSphereNodeColumns createFunctionSpace(const atlas::Mesh& csMesh) {
+  oops::Log::debug() << "monio::test::createFunctionSpace()" << std::endl;
+  const auto functionSpace = atlas::functionspace::CubedSphereNodeColumns(csMesh);
+  return functionSpace;
+}
+
+/// Value held in the file at a horizontal index and level. Whole numbers are exact in doubles.
+double fileValue(const std::size_t fileIndex, const std::size_t level) {
+  return static_cast<double>((fileIndex * 100) + level);
+}
+
+/// Returns the global indices of the nodes owned by every PE, in order of PE and of local node
+std::vector<int> gatherGlobalIndices(const atlas::Field& field) {
+  oops::Log::info() << "monio::test::gatherGlobalIndices()" << std::endl;
+  auto ghostView = atlas::array::make_view<int, 1>(field.functionspace().ghost());
+  auto globalIndexView = atlas::array::make_view<atlas::gidx_t, 1>(
+                                                      field.functionspace().global_index());
+  std::vector<int> localGlobalIndices;
+  for (atlas::idx_t i = 0; i < ghostView.shape(0); ++i) {
+    if (ghostView(i) == 0) {
+      localGlobalIndices.push_back(globalIndexView(i) - 1);  // Atlas global indices start at 1
+    }
+  }
+  eckit::mpi::Buffer<int> globalIndices(atlas::mpi::comm().size());
+  atlas::mpi::comm().allGatherv(localGlobalIndices.begin(), localGlobalIndices.end(),
+                                globalIndices);
+  return globalIndices.buffer;
+}
+
+/// Creates a map under which the owned columns of each PE are contiguous in the file, in the order
+/// of local nodes, or are in reverse order where isContiguous is false.
+std::vector<uint32_t> createMap(const std::vector<int>& globalIndices, const bool isContiguous) {
+  oops::Log::info() << "monio::test::createMap()> isContiguous: " << isContiguous << std::endl;
+  const std::size_t horizontalSize = globalIndices.size();
+  std::vector<uint32_t> lfricAtlasMap(horizontalSize);
+  for (std::size_t i = 0; i < horizontalSize; ++i) {
+    lfricAtlasMap[globalIndices[i]] = isContiguous == true ? i : horizontalSize - 1 - i;
+  }
+  return lfricAtlasMap;
+}
+
+/// Checks the identity detection of ParallelPlan. Columns are in identity order where they are
+/// contiguous and owned nodes precede any others.
+void checkPlan(const atlas::Field& field,
+               const std::vector<uint32_t>& lfricAtlasMap,
+               const bool isContiguous) {
+  oops::Log::info() << "monio::test::checkPlan()" << std::endl;
+  auto ghostView = atlas::array::make_view<int, 1>(field.functionspace().ghost());
+  atlas::idx_t numOwned = 0;
+  bool isOwnedFirst = true;
+  for (atlas::idx_t i = 0; i < ghostView.shape(0); ++i) {
+    if (ghostView(i) == 0) {
+      isOwnedFirst = isOwnedFirst == true && i == numOwned;
+      numOwned++;
+    }
+  }
+  ParallelPlan plan;
+  plan.create(atlas::mpi::comm(), field, lfricAtlasMap, 0);
+  const bool isIdentity = (isContiguous == true || numOwned < 2) && isOwnedFirst == true;
+  if (plan.isIdentity() != isIdentity) {
+    utils::throwException("ParallelPlan::isIdentity() does not match the expected order...");
+  }
+}
+
+/// Scatters data in file order from the owning PE, then checks each owned node holds the file data
+/// of its column
+void scatterAndCheck(std::vector<atlas::Field>& fields,
+                     const std::vector<uint32_t>& lfricAtlasMap,
+                     const std::size_t blockLevels) {
+  oops::Log::info() << "monio::test::scatterAndCheck()> blockLevels: " << blockLevels << std::endl;
+  const std::size_t horizontalSize = lfricAtlasMap.size();
+  FieldScatterer fieldScatterer(atlas::mpi::comm(), consts::kMPIRankOwner);
+  fieldScatterer.createPlan(fields.front(), {consts::kMPIRankOwner}, lfricAtlasMap);
+  FieldScatterer::DataContainerGetter getDataContainer =
+      [&](std::size_t, std::size_t fileLevelStart, std::size_t numLevels) {
+    std::vector<double> dataVec(horizontalSize * numLevels);
+    for (std::size_t j = 0; j < numLevels; ++j) {
+      for (std::size_t fileIndex = 0; fileIndex < horizontalSize; ++fileIndex) {
+        dataVec[(j * horizontalSize) + fileIndex] = fileValue(fileIndex, fileLevelStart + j);
+      }
+    }
+    std::shared_ptr<DataContainerDouble> dataContainer =
+                                              std::make_shared<DataContainerDouble>("data");
+    dataContainer->setData(dataVec);
+    return std::static_pointer_cast<DataContainerBase>(dataContainer);
+  };
+  const std::vector<std::size_t> sourceRanks(fields.size(), consts::kMPIRankOwner);
+  const std::vector<consts::LevelRemap> levelRemaps(fields.size());
+  fieldScatterer.scatter(fields, sourceRanks, getDataContainer, levelRemaps, blockLevels);
+
+  for (const auto& field : fields) {
+    auto ghostView = atlas::array::make_view<int, 1>(field.functionspace().ghost());
+    auto globalIndexView = atlas::array::make_view<atlas::gidx_t, 1>(
+                                                        field.functionspace().global_index());
+    auto fieldView = atlas::array::make_view<const double, 2>(field);
+    for (atlas::idx_t i = 0; i < fieldView.shape(0); ++i) {
+      if (ghostView(i) == 0) {
+        const std::size_t fileIndex = lfricAtlasMap[globalIndexView(i) - 1];
+        for (atlas::idx_t j = 0; j < fieldView.shape(1); ++j) {
+          if (fieldView(i, j) != fileValue(fileIndex, j)) {
+            utils::throwException("Field \"" + field.name() + "\" does not match the file " +
+                                  "data of its columns...");
+          }
+        }
+      }
+    }
+  }
+}
+
+void main() {
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  const std::string gridName(paramConfig.getString("gridName"));
+  const std::string partitionerType(paramConfig.getString("partitionerType"));
+  const std::string meshType(paramConfig.getString("meshType"));
+  const int numLevels = paramConfig.getInt("numLevels");
+  const std::size_t blockLevels = paramConfig.getInt("blockLevels");
+
+  atlas::CubedSphereGrid grid(gridName);
+  atlas::Mesh mesh(createMesh(grid, partitionerType, meshType));
+  atlas::functionspace::CubedSphereNodeColumns functionSpace(createFunctionSpace(mesh));
+  // Single-level fields of contiguous columns are copied without permutation
+  std::vector<atlas::Field> fields = {
+      functionSpace.createField<double>(atlas::option::name("single_level") |
+                                        atlas::option::levels(1)),
+      functionSpace.createField<double>(atlas::option::name("multi_level") |
+                                        atlas::option::levels(numLevels))};
+
+  const std::vector<int> globalIndices = gatherGlobalIndices(fields.front());
+  for (const bool isContiguous : {true, false}) {
+    const std::vector<uint32_t> lfricAtlasMap = createMap(globalIndices, isContiguous);
+    checkPlan(fields.front(), lfricAtlasMap, isContiguous);
+    scatterAndCheck(fields, lfricAtlasMap, 0);
+    scatterAndCheck(fields, lfricAtlasMap, blockLevels);
+  }
+}
+
+class FieldScatter : public oops::Test{
+ public:
+  FieldScatter() {}
+  virtual ~FieldScatter() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::FieldScatter";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_field_scatter", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
@@ -10,50 +10,31 @@
 
 #define ECKIT_TESTING_SELF_REGISTER_CASES 0
 
-#include <algorithm>
-#include <map>
-#include <memory>
 #include <string>
 #include <vector>
 
 #include "atlas/field.h"
 #include "atlas/functionspace/CubedSphereColumns.h"
-#include "atlas/grid/CubedSphereGrid.h"
-#include "atlas/mesh/Mesh.h"
-#include "atlas/meshgenerator/MeshGenerator.h"
 #include "eckit/testing/Test.h"
 
 #include "monio/Constants.h"
 #include "monio/Monio.h"
-#include "monio/Utils.h"
 
 #include "oops/../test/TestEnvironment.h"
 #include "oops/runs/Test.h"
 #include "oops/util/DateTime.h"
 #include "oops/util/Logger.h"
 
+#include "TestUtils.h"
+
 namespace monio {
 namespace test {
 
-atlas::Mesh createMesh(const atlas::CubedSphereGrid& grid,
-                       const std::string& partitionerType,
-                       const std::string& meshType) {
-  oops::Log::debug() << "monio::test::createMesh()" << std::endl;
-  const auto meshConfig = atlas::util::Config("partitioner", partitionerType) |
-                          atlas::util::Config("halo", 0);
-  const auto meshGen = atlas::MeshGenerator(meshType, meshConfig);
-  return meshGen.generate(grid);
-}
-
-atlas::functionspace::CubedSphereNodeColumns createFunctionSpace(const atlas::Mesh& csMesh) {
-  oops::Log::debug() << "monio::test::createFunctionSpace()" << std::endl;
-  const auto functionSpace = atlas::functionspace::CubedSphereNodeColumns(csMesh);
-  return functionSpace;
-}
-
-atlas::FieldSet createFieldSet(const atlas::functionspace::CubedSphereNodeColumns& functionSpace,
-                               std::vector<consts::FieldMetadata>& fieldMetadataVec) {
-  oops::Log::debug() << "monio::test::createFieldSet()" << std::endl;
+/// Creates fields with the levels of the file, rather than those of JEDI
+atlas::FieldSet createFileLevelsFieldSet(
+                    const atlas::functionspace::CubedSphereNodeColumns& functionSpace,
+                    std::vector<consts::FieldMetadata>& fieldMetadataVec) {
+  oops::Log::debug() << "monio::test::createFileLevelsFieldSet()" << std::endl;
   atlas::FieldSet fieldSet;
   for (const auto& fieldMetadata : fieldMetadataVec) {
     // No error checking on metadata. This is handled by calls to Monio
@@ -71,18 +52,6 @@ void write(const atlas::FieldSet& fieldSet, const std::string& outputFilePath) {
   Monio::get().writeFieldSet(fieldSet, outputFilePath);
 }
 
-/// Reads data from file and populates the FieldSet
-void readInput(atlas::FieldSet& fieldSet,
-               const std::vector<consts::FieldMetadata>& fieldMetadataVec,
-               const util::DateTime& dateTime,
-               const std::string& inputFilePath) {
-  oops::Log::info() << "monio::test::readInput()" << std::endl;
-  oops::Log::info() << "inputFilePath> " << inputFilePath << std::endl;
-  oops::Log::info() << "dateTime> " << dateTime << std::endl;
-
-  Monio::get().readState(fieldSet, fieldMetadataVec, inputFilePath, dateTime);
-}
-
 /// Sets up the objects required to mimic an operational call to Monio::Read via readInput
 void initParams(atlas::FieldSet& fieldSet,
                 std::vector<consts::FieldMetadata>& fieldMetadataVec,
@@ -92,34 +61,11 @@ void initParams(atlas::FieldSet& fieldSet,
   oops::Log::info() << "monio::test::init()" << std::endl;
   // FieldSet
   const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
-  const std::string gridName(paramConfig.getString("gridName"));
-  const std::string partitionerType(paramConfig.getString("partitionerType"));
-  const std::string meshType(paramConfig.getString("meshType"));
-
-  // Initialise Atlas objects to produce FieldSet
-  atlas::CubedSphereGrid grid(gridName);
-  atlas::Mesh mesh(createMesh(grid, partitionerType, meshType));
-  atlas::functionspace::CubedSphereNodeColumns functionSpace(createFunctionSpace(mesh));
+  atlas::functionspace::CubedSphereNodeColumns functionSpace(createFunctionSpace(paramConfig));
 
   // fieldMetadata
-  const eckit::LocalConfiguration fieldMetadata = paramConfig.getSubConfiguration("fieldMetadata");
-  for (const auto& key : fieldMetadata.keys()) {
-    std::vector<std::string> stringVec = utils::strToWords(fieldMetadata.getString(key), ',');
-
-    consts::FieldMetadata fieldMetadata;
-    fieldMetadata.lfricReadName = utils::strNoWhiteSpace(stringVec[consts::eLfricReadName]);
-    fieldMetadata.lfricWriteName = utils::strNoWhiteSpace(stringVec[consts::eLfricWriteName]);
-    fieldMetadata.jediName = utils::strNoWhiteSpace(stringVec[consts::eJediName]);
-    fieldMetadata.lfricVertConfig = utils::strNoWhiteSpace(stringVec[consts::eLfricVertConfig]);
-    fieldMetadata.jediVertConfig = utils::strNoWhiteSpace(stringVec[consts::eJediVertConfig]);
-    fieldMetadata.units = utils::strNoWhiteSpace(stringVec[consts::eUnits]);
-    fieldMetadata.numberOfLevels =
-                    std::stoi(utils::strNoWhiteSpace(stringVec[consts::eNumberOfLevels]));
-    fieldMetadata.noFirstLevel = utils::strToBool(stringVec[consts::eNoFirstLevel]);
-
-    fieldMetadataVec.push_back(fieldMetadata);
-  }
-  fieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  parseFieldMetadata(paramConfig.getSubConfiguration("fieldMetadata"), fieldMetadataVec);
+  fieldSet = createFileLevelsFieldSet(functionSpace, fieldMetadataVec);
   // Others
   dateTime = util::DateTime(paramConfig.getString("dateTime"));
   inputFilePath = paramConfig.getString("inputFilePath");
@@ -0,0 +1,103 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "atlas/grid/CubedSphereGrid.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/util/Point.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/Constants.h"
+#include "monio/DataContainerBase.h"
+#include "monio/FileData.h"
+#include "monio/Reader.h"
+#include "monio/Utils.h"
+#include "monio/UtilsAtlas.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/Logger.h"
+
+namespace monio {
+namespace test {
+
+/// Reads the LFRic coordinates of a file, as Monio::warmMapCache
+std::vector<atlas::PointLonLat> readLfricCoords(const std::string& filePath) {
+  oops::Log::info() << "monio::test::readLfricCoords()" << std::endl;
+  FileData fileData;
+  Reader reader(atlas::mpi::comm(), consts::kMPIRankOwner, filePath);
+  reader.readMetadata(fileData);
+  reader.readFullData(fileData, consts::kLfricCoordVarNames);
+  reader.closeFile();
+  std::vector<std::shared_ptr<DataContainerBase>> coordData =
+                                      reader.getCoordData(fileData, consts::kLfricCoordVarNames);
+  return utilsatlas::getLfricCoords(coordData);
+}
+
+/// Generates the map in closed form, which must succeed, and checks it against the KD-tree map
+void compareMaps(const std::vector<atlas::PointLonLat>& atlasCoords,
+                 const std::vector<atlas::PointLonLat>& lfricCoords) {
+  oops::Log::info() << "monio::test::compareMaps()" << std::endl;
+  std::vector<uint32_t> cubedSphereMap;
+  if (utilsatlas::createCubedSphereLfricAtlasMap(atlasCoords, lfricCoords,
+                                                 cubedSphereMap) == false) {
+    utils::throwException("Map was not generated in closed form...");
+  }
+  std::vector<uint32_t> kdTreeMap = utilsatlas::createKDTreeLfricAtlasMap(atlasCoords,
+                                                                          lfricCoords);
+  if (cubedSphereMap != kdTreeMap) {
+    utils::throwException("Closed-form map does not match the KD-tree map...");
+  }
+}
+
+void main() {
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  const std::string gridName(paramConfig.getString("gridName"));
+  const std::string inputFilePath(paramConfig.getString("inputFilePath"));
+  oops::Log::info() << "gridName> " << gridName << ", inputFilePath> " << inputFilePath
+                    << std::endl;
+
+  std::vector<atlas::PointLonLat> atlasCoords =
+                                      utilsatlas::getAtlasCoords(atlas::CubedSphereGrid(gridName));
+  std::vector<atlas::PointLonLat> lfricCoords = readLfricCoords(inputFilePath);
+  compareMaps(atlasCoords, lfricCoords);
+  // Reversal rotates each panel through 180 degrees and reverses their order, which the closed
+  // form must also accommodate.
+  std::reverse(lfricCoords.begin(), lfricCoords.end());
+  compareMaps(atlasCoords, lfricCoords);
+}
+
+class LfricAtlasMap : public oops::Test{
+ public:
+  LfricAtlasMap() {}
+  virtual ~LfricAtlasMap() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::LfricAtlasMap";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_lfric_atlas_map", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
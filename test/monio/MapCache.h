@@ -0,0 +1,152 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "eckit/testing/Test.h"
+
+#include "monio/Constants.h"
+#include "monio/LfricAtlasMapCache.h"
+#include "monio/Utils.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/Logger.h"
+
+namespace monio {
+namespace test {
+
+/// Byte offsets of the fields of a cache file, as LfricAtlasMapCache::writeMapFile
+std::size_t getVersionOffset() {
+  return consts::kMapCacheFileId.size();
+}
+
+std::size_t getMapSizeOffset(const std::string& key) {
+  return getVersionOffset() + (2 * sizeof(uint32_t)) + key.size();
+}
+
+std::size_t getMapOffset(const std::string& key) {
+  return getMapSizeOffset(key) + sizeof(uint64_t);
+}
+
+std::vector<char> readBytes(const std::string& filePath) {
+  std::ifstream file(filePath, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void writeBytes(const std::string& filePath, const std::vector<char>& bytes) {
+  std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+  file.write(bytes.data(), bytes.size());
+}
+
+/// Stores a map with one cache, then finds it on disk with another. Maps must be identical.
+void writeAndRead(const std::string& cacheDirPath,
+                  const std::string& key,
+                  const std::vector<uint32_t>& lfricAtlasMap) {
+  oops::Log::info() << "monio::test::writeAndRead()" << std::endl;
+  {
+    LfricAtlasMapCache writeCache;
+    writeCache.setCacheDirectory(cacheDirPath);
+    writeCache.storeMap(key, lfricAtlasMap);
+  }
+  LfricAtlasMapCache readCache;
+  readCache.setCacheDirectory(cacheDirPath);
+  std::vector<uint32_t> readMap;
+  if (readCache.findMap(key, readMap) == false) {
+    utils::throwException("Map was not read from the cache file...");
+  }
+  if (readMap != lfricAtlasMap) {
+    utils::throwException("Map read from the cache file does not match that written...");
+  }
+}
+
+/// Modifies a valid cache file, which must then be ignored by a new cache
+void rejectFile(const std::string& cacheDirPath,
+                const std::string& key,
+                const std::vector<char>& validBytes,
+                const std::string& description,
+                const std::function<void(std::vector<char>&)>& modify) {
+  oops::Log::info() << "monio::test::rejectFile()> " << description << std::endl;
+  const std::string filePath = cacheDirPath + "/" + key +
+                               std::string(consts::kMapCacheFileExtension);
+  std::vector<char> bytes = validBytes;
+  modify(bytes);
+  writeBytes(filePath, bytes);
+  LfricAtlasMapCache cache;
+  cache.setCacheDirectory(cacheDirPath);
+  std::vector<uint32_t> readMap;
+  if (cache.findMap(key, readMap) == true) {
+    utils::throwException("Cache file with " + description + " was not rejected...");
+  }
+}
+
+void main() {
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  const std::string cacheDirPath = paramConfig.getString("cacheDirPath");
+  const std::string key = paramConfig.getString("key");
+  const std::size_t mapSize = paramConfig.getInt("mapSize");
+  oops::Log::info() << "cacheDirPath> " << cacheDirPath << ", key> " << key << std::endl;
+
+  std::vector<uint32_t> lfricAtlasMap(mapSize);
+  std::iota(lfricAtlasMap.rbegin(), lfricAtlasMap.rend(), 0);
+  writeAndRead(cacheDirPath, key, lfricAtlasMap);
+
+  const std::string filePath = cacheDirPath + "/" + key +
+                               std::string(consts::kMapCacheFileExtension);
+  const std::vector<char> validBytes = readBytes(filePath);
+  if (validBytes.size() != getMapOffset(key) + (mapSize * sizeof(uint32_t))) {
+    utils::throwException("Cache file is not of the expected size...");
+  }
+  rejectFile(cacheDirPath, key, validBytes, "wrong version", [&](std::vector<char>& bytes) {
+    const uint32_t version = consts::kMapCacheVersion + 1;
+    std::memcpy(&bytes[getVersionOffset()], &version, sizeof(version));
+  });
+  rejectFile(cacheDirPath, key, validBytes, "wrong map size", [&](std::vector<char>& bytes) {
+    const uint64_t fileMapSize = mapSize + 1;
+    std::memcpy(&bytes[getMapSizeOffset(key)], &fileMapSize, sizeof(fileMapSize));
+  });
+  rejectFile(cacheDirPath, key, validBytes, "truncated map", [&](std::vector<char>& bytes) {
+    bytes.resize(bytes.size() - sizeof(uint32_t));
+  });
+  rejectFile(cacheDirPath, key, validBytes, "out-of-range entry", [&](std::vector<char>& bytes) {
+    const uint32_t mapEntry = mapSize;
+    std::memcpy(&bytes[getMapOffset(key)], &mapEntry, sizeof(mapEntry));
+  });
+}
+
+class MapCache : public oops::Test{
+ public:
+  MapCache() {}
+  virtual ~MapCache() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::MapCache";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_map_cache", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
@@ -0,0 +1,212 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "atlas/parallel/mpi/mpi.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/AttributeDouble.h"
+#include "monio/AttributeInt.h"
+#include "monio/Constants.h"
+#include "monio/DataContainerDouble.h"
+#include "monio/FileData.h"
+#include "monio/Reader.h"
+#include "monio/Utils.h"
+#include "monio/Variable.h"
+#include "monio/Writer.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/Logger.h"
+
+namespace monio {
+namespace test {
+
+/// Returns values spaced evenly between, and including, the minimum and maximum
+std::vector<double> createValues(const double minValue,
+                                 const double maxValue,
+                                 const std::size_t numValues) {
+  oops::Log::debug() << "monio::test::createValues()" << std::endl;
+  std::vector<double> values(numValues);
+  for (std::size_t i = 0; i < numValues; ++i) {
+    values[i] = minValue + ((maxValue - minValue) * i) / (numValues - 1);
+  }
+  return values;
+}
+
+/// Checks that unpacked values lie within half a packing interval of the original values, and that
+/// NaN values are unpacked as NaN
+void compare(const std::vector<double>& values,
+             const std::vector<double>& unpackedValues,
+             const double scaleFactor) {
+  oops::Log::info() << "monio::test::compare()" << std::endl;
+  if (values.size() != unpackedValues.size()) {
+    utils::throwException("Unpacked values do not match in size...");
+  }
+  const double tolerance = (scaleFactor / 2.0) * (1.0 + 1e-6);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (std::isnan(values[i]) != std::isnan(unpackedValues[i]) ||
+        std::abs(values[i] - unpackedValues[i]) > tolerance) {
+      utils::throwException("Unpacked value " + std::to_string(unpackedValues[i]) +
+                            " does not match " + std::to_string(values[i]) + "...");
+    }
+  }
+}
+
+/// Packs and unpacks values in memory. Packed values must be whole and lie within the packed range,
+/// so that none is the fill value.
+void packInMemory(const std::vector<double>& values, const consts::Packing& packing) {
+  oops::Log::info() << "monio::test::packInMemory()" << std::endl;
+  std::vector<double> packedValues = values;
+  if (utils::packData(packedValues, packing) != 0) {
+    utils::throwException("Values within the packed range are clamped...");
+  }
+  for (const auto& packedValue : packedValues) {
+    if (packedValue != std::round(packedValue) || std::abs(packedValue) > packing.packedMax ||
+        packedValue == packing.fillValue) {
+      utils::throwException("Packed value " + std::to_string(packedValue) + " is invalid...");
+    }
+  }
+  std::vector<double> unpackedValues = packedValues;
+  utils::unpackData(unpackedValues, packing);
+  compare(values, unpackedValues, packing.scaleFactor);
+}
+
+/// Packs values beyond either end of the packed range, as where appended states exceed the range of
+/// the first state written. These must be clamped to the ends of the range.
+void packOutOfRange(const double minValue,
+                    const double maxValue,
+                    const consts::Packing& packing) {
+  oops::Log::info() << "monio::test::packOutOfRange()" << std::endl;
+  const double margin = maxValue - minValue;
+  std::vector<double> packedValues = {minValue - margin, maxValue + margin};
+  if (utils::packData(packedValues, packing) != packedValues.size() ||
+      packedValues.front() != -packing.packedMax || packedValues.back() != packing.packedMax) {
+    utils::throwException("Values outside the packed range are not clamped...");
+  }
+  std::vector<double> unpackedValues = packedValues;
+  utils::unpackData(unpackedValues, packing);
+  compare({minValue, maxValue}, unpackedValues, packing.scaleFactor);
+}
+
+/// Packs NaN values, which must be packed as the fill value, without clamping, and unpacked as NaN.
+void packMissing(const consts::Packing& packing) {
+  oops::Log::info() << "monio::test::packMissing()" << std::endl;
+  const std::vector<double> values = {std::numeric_limits<double>::quiet_NaN()};
+  std::vector<double> packedValues = values;
+  if (utils::packData(packedValues, packing) != 0 ||
+      packedValues.front() != packing.fillValue) {
+    utils::throwException("NaN is not packed as the fill value...");
+  }
+  std::vector<double> unpackedValues = packedValues;
+  utils::unpackData(unpackedValues, packing);
+  compare(values, unpackedValues, packing.scaleFactor);
+}
+
+/// Writes values to a CF-packed variable of the given type, then reads them back. Values are packed
+/// as they are written and unpacked as they are read. A NaN value is appended, which is written as
+/// the fill value.
+void packInFile(const std::vector<double>& unfilledValues,
+                const consts::Packing& packing,
+                const int packedType,
+                const std::string& filePath) {
+  oops::Log::info() << "monio::test::packInFile()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+  const std::string dimName = "nValues";
+  const std::string varName = "packed_values";
+  std::vector<double> values = unfilledValues;
+  values.push_back(std::numeric_limits<double>::quiet_NaN());
+
+  FileData writeFileData;
+  writeFileData.getMetadata().addDimension(dimName, values.size());
+  std::shared_ptr<Variable> var = std::make_shared<Variable>(varName, packedType);
+  var->addDimension(dimName, values.size());
+  var->addAttribute(std::make_shared<AttributeDouble>(std::string(consts::kScaleFactorName),
+                                                      packing.scaleFactor));
+  var->addAttribute(std::make_shared<AttributeDouble>(std::string(consts::kAddOffsetName),
+                                                      packing.addOffset));
+  var->addAttribute(std::make_shared<AttributeInt>(std::string(consts::kFillValueName),
+                                                   static_cast<int>(packing.fillValue)));
+  writeFileData.getMetadata().addVariable(varName, var);
+  std::shared_ptr<DataContainerDouble> dataContainer =
+                                              std::make_shared<DataContainerDouble>(varName);
+  dataContainer->setData(values);
+  writeFileData.getData().addContainer(dataContainer);
+
+  Writer writer(atlas::mpi::comm(), consts::kMPIRankOwner, filePath);
+  writer.writeMetadata(writeFileData.getMetadata());
+  writer.writeData(writeFileData);
+  writer.closeFile();
+
+  FileData readFileData;
+  Reader reader(atlas::mpi::comm(), consts::kMPIRankOwner, filePath);
+  reader.readMetadata(readFileData);
+  reader.readFullDatum(readFileData, varName);
+  reader.closeFile();
+  if (readFileData.getMetadata().getVariable(varName)->getType() != consts::eDouble) {
+    utils::throwException("Packed variable is not read as its unpacked type...");
+  }
+  std::shared_ptr<DataContainerDouble> readContainer = std::static_pointer_cast<
+                          DataContainerDouble>(readFileData.getData().getContainer(varName));
+  compare(values, readContainer->getData(), packing.scaleFactor);
+}
+
+void main() {
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  const double minValue = paramConfig.getDouble("minValue");
+  const double maxValue = paramConfig.getDouble("maxValue");
+  const std::size_t numValues = paramConfig.getInt("numValues");
+  const std::string outputFilePath = paramConfig.getString("outputFilePath");
+
+  std::vector<double> values = createValues(minValue, maxValue, numValues);
+  // As AtlasWriter::addPackingAttributes
+  for (const int packedType : {consts::eShort, consts::eByte}) {
+    const bool isShort = packedType == consts::eShort;
+    consts::Packing packing;
+    packing.packedMax = isShort == true ? consts::kPackedShortMax : consts::kPackedByteMax;
+    packing.fillValue = isShort == true ? consts::kPackedShortFill : consts::kPackedByteFill;
+    packing.scaleFactor = (maxValue - minValue) / (2.0 * packing.packedMax);
+    packing.addOffset = (maxValue + minValue) / 2.0;
+    oops::Log::info() << "packedType> " << consts::kDataTypeNames[packedType] << std::endl;
+    packInMemory(values, packing);
+    packOutOfRange(minValue, maxValue, packing);
+    packMissing(packing);
+    packInFile(values, packing, packedType, outputFilePath);
+  }
+}
+
+class PackData : public oops::Test{
+ public:
+  PackData() {}
+  virtual ~PackData() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::PackData";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_pack_data", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
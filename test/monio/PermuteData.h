@@ -0,0 +1,161 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <string>
+#include <vector>
+
+#include "eckit/testing/Test.h"
+
+#include "monio/Constants.h"
+#include "monio/Utils.h"
+#include "monio/UtilsPermute.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/Logger.h"
+
+namespace monio {
+namespace test {
+
+/// Values that are never written by either kernel, so untouched elements can be detected
+const double kUnsetValue = -1.0;
+
+/// Returns distinct file indices in a scattered order. The multiplier must share no factor with
+/// horizontalSize.
+std::vector<uint32_t> createFileIndices(const std::size_t numNodes,
+                                        const std::size_t horizontalSize,
+                                        const std::size_t multiplier) {
+  oops::Log::debug() << "monio::test::createFileIndices()" << std::endl;
+  std::vector<uint32_t> fileIndices(numNodes);
+  for (std::size_t node = 0; node < numNodes; ++node) {
+    fileIndices[node] = (node * multiplier) % horizontalSize;
+  }
+  return fileIndices;
+}
+
+/// Reorders columns to file order and checks every element against a direct calculation. Elements
+/// not mapped to, including any surface copies where these are not made, must be left unset.
+void testColumnsToFileOrder(const std::vector<uint32_t>& fileIndices,
+                            const std::size_t numLevels,
+                            const std::size_t columnStride,
+                            const std::size_t horizontalSize,
+                            const consts::LevelRemap& levelRemap) {
+  oops::Log::info() << "monio::test::testColumnsToFileOrder()> levelOffset: "
+                    << levelRemap.levelOffset << ", isSurfaceCopied: "
+                    << levelRemap.isSurfaceCopied << std::endl;
+  const std::size_t numNodes = fileIndices.size();
+  const std::size_t numFileLevels = numLevels + levelRemap.levelOffset;
+  std::vector<double> columns(numNodes * columnStride, kUnsetValue);
+  for (std::size_t node = 0; node < numNodes; ++node) {
+    for (std::size_t j = 0; j < numLevels; ++j) {
+      columns[(node * columnStride) + j] = (node * numLevels) + j;
+    }
+  }
+  std::vector<float> fileData(numFileLevels * horizontalSize, kUnsetValue);
+  utilspermute::columnsToFileOrder(columns.data(), columnStride, fileIndices.data(), numNodes,
+                                   numLevels, fileData.data(), horizontalSize, levelRemap);
+
+  std::vector<float> expectedData(numFileLevels * horizontalSize, kUnsetValue);
+  for (std::size_t node = 0; node < numNodes; ++node) {
+    for (std::size_t j = 0; j < numFileLevels; ++j) {
+      if (j < levelRemap.levelOffset && levelRemap.isSurfaceCopied == false) {
+        continue;
+      }
+      const std::size_t fieldLevel = j < levelRemap.levelOffset ? 0 : j - levelRemap.levelOffset;
+      expectedData[(j * horizontalSize) + fileIndices[node]] =
+          columns[(node * columnStride) + fieldLevel];
+    }
+  }
+  if (fileData != expectedData) {
+    utils::throwException("Data reordered to file order do not match those expected...");
+  }
+}
+
+/// Reorders data in file order to columns and checks every element against a direct calculation.
+/// Elements between columns, where columnStride exceeds numLevels, must be left unset.
+void testFileOrderToColumns(const std::vector<uint32_t>& fileIndices,
+                            const std::size_t numLevels,
+                            const std::size_t columnStride,
+                            const std::size_t horizontalSize,
+                            const consts::LevelRemap& levelRemap) {
+  oops::Log::info() << "monio::test::testFileOrderToColumns()> levelOffset: "
+                    << levelRemap.levelOffset << ", isSurfaceCopied: "
+                    << levelRemap.isSurfaceCopied << std::endl;
+  const std::size_t numNodes = fileIndices.size();
+  const std::size_t numFileLevels = numLevels + levelRemap.levelOffset;
+  std::vector<float> fileData(numFileLevels * horizontalSize);
+  for (std::size_t i = 0; i < fileData.size(); ++i) {
+    fileData[i] = i;
+  }
+  std::vector<double> columns(numNodes * columnStride, kUnsetValue);
+  utilspermute::fileOrderToColumns(fileData.data(), horizontalSize, levelRemap,
+                                   fileIndices.data(), numNodes, numLevels, columns.data(),
+                                   columnStride);
+
+  std::vector<double> expectedColumns(numNodes * columnStride, kUnsetValue);
+  for (std::size_t node = 0; node < numNodes; ++node) {
+    for (std::size_t j = 0; j < numLevels; ++j) {
+      expectedColumns[(node * columnStride) + j] =
+          fileData[((j + levelRemap.levelOffset) * horizontalSize) + fileIndices[node]];
+    }
+  }
+  if (columns != expectedColumns) {
+    utils::throwException("Data reordered to columns do not match those expected...");
+  }
+}
+
+void main() {
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  const std::size_t horizontalSize = paramConfig.getInt("horizontalSize");
+  const std::size_t numNodes = paramConfig.getInt("numNodes");
+  const std::size_t numLevels = paramConfig.getInt("numLevels");
+  const std::size_t columnStride = paramConfig.getInt("columnStride");
+  const std::size_t indexMultiplier = paramConfig.getInt("indexMultiplier");
+
+  std::vector<uint32_t> fileIndices = createFileIndices(numNodes, horizontalSize,
+                                                        indexMultiplier);
+  utilspermute::checkFileIndices(fileIndices.data(), numNodes, horizontalSize,
+                                 "monio::test::main()");
+  // Without a remap, as utils::getLevelRemap for LFRic fields with noFirstLevel, and with a level
+  // offset alone
+  consts::LevelRemap copiedRemap;
+  copiedRemap.levelOffset = 1;
+  copiedRemap.isSurfaceCopied = true;
+  consts::LevelRemap offsetRemap;
+  offsetRemap.levelOffset = 1;
+  for (const auto& levelRemap : {consts::LevelRemap(), copiedRemap, offsetRemap}) {
+    testColumnsToFileOrder(fileIndices, numLevels, columnStride, horizontalSize, levelRemap);
+    testFileOrderToColumns(fileIndices, numLevels, columnStride, horizontalSize, levelRemap);
+  }
+}
+
+class PermuteData : public oops::Test{
+ public:
+  PermuteData() {}
+  virtual ~PermuteData() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::PermuteData";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_permute_data", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
@@ -0,0 +1,201 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field.h"
+#include "atlas/functionspace/CubedSphereColumns.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/Constants.h"
+#include "monio/Monio.h"
+#include "monio/Utils.h"
+#include "monio/UtilsAtlas.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/DateTime.h"
+#include "oops/util/Logger.h"
+
+#include "TestUtils.h"
+
+namespace monio {
+namespace test {
+
+/// Compares a field written with a packed type with that read back. Variables keep the packing of
+/// the first state appended, so values of later states are clamped to its range. Values match to
+/// within half a packing interval.
+void comparePacked(const atlas::Field& writtenField,
+                   const atlas::Field& readField,
+                   const atlas::Field& firstField,
+                   const int outputType) {
+  oops::Log::info() << "monio::test::comparePacked()" << std::endl;
+  const std::pair<double, double> range = utilsatlas::getFieldRange(firstField,
+                                                                     atlas::mpi::comm());
+  const double packedMax = outputType == consts::eShort ? consts::kPackedShortMax :
+                                                          consts::kPackedByteMax;
+  const double scaleFactor = (range.second - range.first) / (2.0 * packedMax);
+  const double tolerance = (scaleFactor / 2.0) * (1.0 + 1e-6);
+  auto writtenView = atlas::array::make_view<const double, 2>(writtenField);
+  auto readView = atlas::array::make_view<const double, 2>(readField);
+  for (atlas::idx_t j = 0; j < writtenView.shape(0); ++j) {
+    for (atlas::idx_t k = 0; k < writtenView.shape(1); ++k) {
+      const double expected = std::clamp(writtenView(j, k), range.first, range.second);
+      if (std::abs(readView(j, k) - expected) > tolerance) {
+        utils::throwException("Packed field \"" + writtenField.name() + "\" does not match...");
+      }
+    }
+  }
+}
+
+/// Compares the fields written at a date-time with those read back. Fields written with a packed
+/// type are compared with the first state written, as above. Others must match exactly.
+void compare(atlas::FieldSet& writtenFieldSet,
+             atlas::FieldSet& readFieldSet,
+             const atlas::FieldSet& firstFieldSet,
+             const std::vector<consts::FieldMetadata>& fieldMetadataVec) {
+  oops::Log::info() << "monio::test::compare()" << std::endl;
+  atlas::FieldSet writtenUnpackedFieldSet;
+  atlas::FieldSet readUnpackedFieldSet;
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    const std::string& name = fieldMetadata.jediName;
+    if (fieldMetadata.outputType == consts::eShort || fieldMetadata.outputType == consts::eByte) {
+      comparePacked(writtenFieldSet[name], readFieldSet[name], firstFieldSet[name],
+                    fieldMetadata.outputType);
+    } else {
+      writtenUnpackedFieldSet.add(writtenFieldSet[name]);
+      readUnpackedFieldSet.add(readFieldSet[name]);
+    }
+  }
+  if (utilsatlas::compareFieldSets(writtenUnpackedFieldSet, readUnpackedFieldSet) == false) {
+    utils::throwException("FieldSets do not match...");
+  }
+}
+
+/// Populates a FieldSet per date-time with the input data, offset by the index of its date-time,
+/// so that the states written at each time step differ
+void offsetInput(const atlas::FieldSet& inputFieldSet,
+                 std::vector<atlas::FieldSet>& fieldSets) {
+  oops::Log::info() << "monio::test::offsetInput()" << std::endl;
+  for (std::size_t i = 0; i < fieldSets.size(); ++i) {
+    for (auto& field : fieldSets[i]) {
+      auto inputView = atlas::array::make_view<double, 2>(inputFieldSet[field.name()]);
+      auto fieldView = atlas::array::make_view<double, 2>(field);
+      for (atlas::idx_t j = 0; j < fieldView.shape(0); ++j) {
+        for (atlas::idx_t k = 0; k < fieldView.shape(1); ++k) {
+          fieldView(j, k) = inputView(j, k) + static_cast<double>(i);
+        }
+      }
+    }
+  }
+}
+
+/// Writes each FieldSet to file at its date-time, in a single time series
+void append(const std::vector<atlas::FieldSet>& fieldSets,
+            const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+            const std::vector<util::DateTime>& dateTimes,
+            const std::string& filePath) {
+  oops::Log::info() << "monio::test::append()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+  for (std::size_t i = 0; i < dateTimes.size(); ++i) {
+    oops::Log::info() << "dateTime> " << dateTimes[i] << std::endl;
+    Monio::get().appendState(fieldSets[i], fieldMetadataVec, filePath, dateTimes[i], i == 0);
+  }
+}
+
+/// Reads data from file at all date-times with a single call
+void readOutput(std::vector<atlas::FieldSet>& fieldSets,
+                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                const std::vector<util::DateTime>& dateTimes,
+                const std::string& filePath) {
+  oops::Log::info() << "monio::test::readOutput()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+  Monio::get().readStates(fieldSets, fieldMetadataVec, filePath, dateTimes);
+}
+
+/// Sets up the objects required to mimic an operational call to Monio::Read via readInput
+void initParams(atlas::FieldSet& inputFieldSet,
+                std::vector<atlas::FieldSet>& appendFieldSets,
+                std::vector<atlas::FieldSet>& outputFieldSets,
+                std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                util::DateTime& dateTime,
+                std::vector<util::DateTime>& appendDateTimes,
+                std::string& inputFilePath,
+                std::string& outputFilePath) {
+  oops::Log::info() << "monio::test::init()" << std::endl;
+  // FieldSet
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  atlas::functionspace::CubedSphereNodeColumns functionSpace(createFunctionSpace(paramConfig));
+
+  // fieldMetadata
+  parseFieldMetadata(paramConfig.getSubConfiguration("fieldMetadata"), fieldMetadataVec);
+  inputFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  // Others
+  dateTime = util::DateTime(paramConfig.getString("dateTime"));
+  for (const auto& dateTimeStr : paramConfig.getStringVector("appendDateTimes")) {
+    appendDateTimes.push_back(util::DateTime(dateTimeStr));
+  }
+  for (std::size_t i = 0; i < appendDateTimes.size(); ++i) {
+    appendFieldSets.push_back(createFieldSet(functionSpace, fieldMetadataVec));
+    outputFieldSets.push_back(createFieldSet(functionSpace, fieldMetadataVec));
+  }
+  inputFilePath = paramConfig.getString("inputFilePath");
+  outputFilePath = paramConfig.getString("outputFilePath");
+}
+
+void main() {
+  atlas::FieldSet inputFieldSet;
+  std::vector<atlas::FieldSet> appendFieldSets;
+  std::vector<atlas::FieldSet> outputFieldSets;
+  std::vector<consts::FieldMetadata> fieldMetadataVec;
+  util::DateTime dateTime;
+  std::vector<util::DateTime> appendDateTimes;
+  std::string inputFilePath;
+  std::string outputFilePath;
+
+  initParams(inputFieldSet, appendFieldSets, outputFieldSets, fieldMetadataVec, dateTime,
+             appendDateTimes, inputFilePath, outputFilePath);
+  readInput(inputFieldSet, fieldMetadataVec, dateTime, inputFilePath);
+  offsetInput(inputFieldSet, appendFieldSets);
+  append(appendFieldSets, fieldMetadataVec, appendDateTimes, outputFilePath);
+  readOutput(outputFieldSets, fieldMetadataVec, appendDateTimes, outputFilePath);
+  for (std::size_t i = 0; i < appendDateTimes.size(); ++i) {
+    compare(appendFieldSets[i], outputFieldSets[i], appendFieldSets.front(), fieldMetadataVec);
+  }
+}
+
+class StateAppend : public oops::Test{
+ public:
+  StateAppend() {}
+  virtual ~StateAppend() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::StateAppend";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_state_append", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
@@ -0,0 +1,101 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <string>
+#include <vector>
+
+#include "atlas/field.h"
+#include "atlas/functionspace/CubedSphereColumns.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/Constants.h"
+#include "monio/Monio.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/DateTime.h"
+#include "oops/util/Logger.h"
+
+#include "TestUtils.h"
+
+namespace monio {
+namespace test {
+
+/// Sets up the objects required to mimic an operational call to Monio::Read via readInput
+void initParams(atlas::FieldSet& serialFieldSet,
+                atlas::FieldSet& ioRanksFieldSet,
+                atlas::FieldSet& parallelFieldSet,
+                std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                util::DateTime& dateTime,
+                std::string& inputFilePath,
+                std::vector<int>& ioRanks) {
+  oops::Log::info() << "monio::test::init()" << std::endl;
+  // FieldSet
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  atlas::functionspace::CubedSphereNodeColumns functionSpace(createFunctionSpace(paramConfig));
+
+  // fieldMetadata
+  parseFieldMetadata(paramConfig.getSubConfiguration("fieldMetadata"), fieldMetadataVec);
+  serialFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  ioRanksFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  parallelFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  // Others
+  dateTime = util::DateTime(paramConfig.getString("dateTime"));
+  inputFilePath = paramConfig.getString("inputFilePath");
+  ioRanks = paramConfig.getIntVector("ioRanks");
+}
+
+void main() {
+  atlas::FieldSet serialFieldSet;
+  atlas::FieldSet ioRanksFieldSet;
+  atlas::FieldSet parallelFieldSet;
+  std::vector<consts::FieldMetadata> fieldMetadataVec;
+  util::DateTime dateTime;
+  std::string inputFilePath;
+  std::vector<int> ioRanks;
+
+  initParams(serialFieldSet, ioRanksFieldSet, parallelFieldSet, fieldMetadataVec,
+             dateTime, inputFilePath, ioRanks);
+  readInput(serialFieldSet, fieldMetadataVec, dateTime, inputFilePath);
+
+  Monio::get().setIORanks(ioRanks);
+  readInput(ioRanksFieldSet, fieldMetadataVec, dateTime, inputFilePath);
+  Monio::get().setIORanks({});
+  compare(serialFieldSet, ioRanksFieldSet);
+
+  Monio::get().setParallelRead(true);
+  readInput(parallelFieldSet, fieldMetadataVec, dateTime, inputFilePath);
+  Monio::get().setParallelRead(false);
+  compare(serialFieldSet, parallelFieldSet);
+}
+
+class StateParallelRead : public oops::Test{
+ public:
+  StateParallelRead() {}
+  virtual ~StateParallelRead() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::StateParallelRead";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_state_parallel_read", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
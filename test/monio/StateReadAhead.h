@@ -0,0 +1,107 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <string>
+#include <vector>
+
+#include "atlas/field.h"
+#include "atlas/functionspace/CubedSphereColumns.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/Constants.h"
+#include "monio/Monio.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/DateTime.h"
+#include "oops/util/Logger.h"
+
+#include "TestUtils.h"
+
+namespace monio {
+namespace test {
+
+/// Sets up the objects required to mimic an operational call to Monio::Read via readInput
+void initParams(atlas::FieldSet& unbufferedFieldSet,
+                atlas::FieldSet& bufferedFieldSet,
+                atlas::FieldSet& ioRanksFieldSet,
+                std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                util::DateTime& dateTime,
+                std::string& inputFilePath,
+                int& readBufferCount,
+                std::vector<int>& ioRanks) {
+  oops::Log::info() << "monio::test::init()" << std::endl;
+  // FieldSet
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  atlas::functionspace::CubedSphereNodeColumns functionSpace(createFunctionSpace(paramConfig));
+
+  // fieldMetadata
+  parseFieldMetadata(paramConfig.getSubConfiguration("fieldMetadata"), fieldMetadataVec);
+  unbufferedFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  bufferedFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  ioRanksFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  // Others
+  dateTime = util::DateTime(paramConfig.getString("dateTime"));
+  inputFilePath = paramConfig.getString("inputFilePath");
+  readBufferCount = paramConfig.getInt("readBufferCount");
+  ioRanks = paramConfig.getIntVector("ioRanks");
+}
+
+void main() {
+  atlas::FieldSet unbufferedFieldSet;
+  atlas::FieldSet bufferedFieldSet;
+  atlas::FieldSet ioRanksFieldSet;
+  std::vector<consts::FieldMetadata> fieldMetadataVec;
+  util::DateTime dateTime;
+  std::string inputFilePath;
+  int readBufferCount;
+  std::vector<int> ioRanks;
+
+  initParams(unbufferedFieldSet, bufferedFieldSet, ioRanksFieldSet, fieldMetadataVec, dateTime,
+             inputFilePath, readBufferCount, ioRanks);
+  // Fields are read as they are distributed, without an I/O thread
+  Monio::get().setReadBufferCount(0);
+  readInput(unbufferedFieldSet, fieldMetadataVec, dateTime, inputFilePath);
+
+  Monio::get().setReadBufferCount(readBufferCount);
+  readInput(bufferedFieldSet, fieldMetadataVec, dateTime, inputFilePath);
+  compare(unbufferedFieldSet, bufferedFieldSet);
+
+  // Each I/O rank reads ahead on its own I/O thread
+  Monio::get().setIORanks(ioRanks);
+  readInput(ioRanksFieldSet, fieldMetadataVec, dateTime, inputFilePath);
+  Monio::get().setIORanks({});
+  Monio::get().setReadBufferCount(consts::kReadBufferCount);
+  compare(unbufferedFieldSet, ioRanksFieldSet);
+}
+
+class StateReadAhead : public oops::Test{
+ public:
+  StateReadAhead() {}
+  virtual ~StateReadAhead() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::StateReadAhead";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_state_read_ahead", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
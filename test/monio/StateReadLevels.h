@@ -0,0 +1,123 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <string>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field.h"
+#include "atlas/functionspace/CubedSphereColumns.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/Constants.h"
+#include "monio/Monio.h"
+#include "monio/Utils.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/DateTime.h"
+#include "oops/util/Logger.h"
+
+#include "TestUtils.h"
+
+namespace monio {
+namespace test {
+
+/// Compares fields read from a given file level with the corresponding levels of fields read in
+/// full. Fields read in full begin at the zeroth level of the file.
+void compareLevels(const atlas::FieldSet& fullFieldSet,
+                   const atlas::FieldSet& levelsFieldSet,
+                   const std::vector<consts::FieldMetadata>& levelsMetadataVec) {
+  oops::Log::info() << "monio::test::compareLevels()" << std::endl;
+  for (const auto& fieldMetadata : levelsMetadataVec) {
+    auto fullView = atlas::array::make_view<const double, 2>(fullFieldSet[fieldMetadata.jediName]);
+    auto levelsView = atlas::array::make_view<const double, 2>(
+                                                        levelsFieldSet[fieldMetadata.jediName]);
+    for (atlas::idx_t j = 0; j < levelsView.shape(0); ++j) {
+      for (atlas::idx_t k = 0; k < levelsView.shape(1); ++k) {
+        if (levelsView(j, k) != fullView(j, fieldMetadata.readLevelStart + k)) {
+          utils::throwException("Field \"" + fieldMetadata.jediName + "\" does not match the " +
+                                "levels read in full...");
+        }
+      }
+    }
+  }
+}
+
+/// Populates a vector of FieldMetadata from a configuration of comma-separated values
+/// Sets up the objects required to mimic an operational call to Monio::Read via readInput
+void initParams(atlas::FieldSet& fullFieldSet,
+                atlas::FieldSet& serialFieldSet,
+                atlas::FieldSet& parallelFieldSet,
+                std::vector<consts::FieldMetadata>& fullMetadataVec,
+                std::vector<consts::FieldMetadata>& levelsMetadataVec,
+                util::DateTime& dateTime,
+                std::string& inputFilePath) {
+  oops::Log::info() << "monio::test::init()" << std::endl;
+  // FieldSet
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  atlas::functionspace::CubedSphereNodeColumns functionSpace(createFunctionSpace(paramConfig));
+
+  // fieldMetadata
+  parseFieldMetadata(paramConfig.getSubConfiguration("fieldMetadata"), fullMetadataVec);
+  parseFieldMetadata(paramConfig.getSubConfiguration("levelsFieldMetadata"), levelsMetadataVec);
+  fullFieldSet = createFieldSet(functionSpace, fullMetadataVec);
+  serialFieldSet = createFieldSet(functionSpace, levelsMetadataVec);
+  parallelFieldSet = createFieldSet(functionSpace, levelsMetadataVec);
+  // Others
+  dateTime = util::DateTime(paramConfig.getString("dateTime"));
+  inputFilePath = paramConfig.getString("inputFilePath");
+}
+
+void main() {
+  atlas::FieldSet fullFieldSet;
+  atlas::FieldSet serialFieldSet;
+  atlas::FieldSet parallelFieldSet;
+  std::vector<consts::FieldMetadata> fullMetadataVec;
+  std::vector<consts::FieldMetadata> levelsMetadataVec;
+  util::DateTime dateTime;
+  std::string inputFilePath;
+
+  initParams(fullFieldSet, serialFieldSet, parallelFieldSet, fullMetadataVec, levelsMetadataVec,
+             dateTime, inputFilePath);
+  readInput(fullFieldSet, fullMetadataVec, dateTime, inputFilePath);
+
+  readInput(serialFieldSet, levelsMetadataVec, dateTime, inputFilePath);
+  compareLevels(fullFieldSet, serialFieldSet, levelsMetadataVec);
+
+  Monio::get().setParallelRead(true);
+  readInput(parallelFieldSet, levelsMetadataVec, dateTime, inputFilePath);
+  Monio::get().setParallelRead(false);
+  compareLevels(fullFieldSet, parallelFieldSet, levelsMetadataVec);
+}
+
+class StateReadLevels : public oops::Test{
+ public:
+  StateReadLevels() {}
+  virtual ~StateReadLevels() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::StateReadLevels";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_state_read_levels", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
@@ -0,0 +1,219 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <netcdf.h>
+
+#include <string>
+#include <vector>
+
+#include "atlas/field.h"
+#include "atlas/functionspace/CubedSphereColumns.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/Constants.h"
+#include "monio/Monio.h"
+#include "monio/Utils.h"
+#include "monio/UtilsAtlas.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/DateTime.h"
+#include "oops/util/Logger.h"
+
+#include "TestUtils.h"
+
+namespace monio {
+namespace test {
+
+/// Compares the fields of two FieldSets, other than that named, which is quantised
+void compareUnquantised(atlas::FieldSet& firstFieldSet,
+                        atlas::FieldSet& secondFieldSet,
+                        const std::string& quantisedName) {
+  oops::Log::info() << "monio::test::compareUnquantised()" << std::endl;
+  atlas::FieldSet firstUnquantisedFieldSet;
+  atlas::FieldSet secondUnquantisedFieldSet;
+  for (const auto& field : firstFieldSet) {
+    if (field.name() != quantisedName) {
+      firstUnquantisedFieldSet.add(field);
+      secondUnquantisedFieldSet.add(secondFieldSet[field.name()]);
+    }
+  }
+  if (utilsatlas::compareFieldSets(firstUnquantisedFieldSet, secondUnquantisedFieldSet) == false) {
+    utils::throwException("FieldSets do not match...");
+  }
+}
+
+/// Checks the storage of each field variable of a written file with the NetCDF library. All are
+/// compressed with deflate at the given level. Only the variable of quantisedName is quantised.
+void checkStorage(const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                  const std::string& filePath,
+                  const int compressionLevel,
+                  const std::string& quantisedName,
+                  const int quantisationPrecision) {
+  oops::Log::info() << "monio::test::checkStorage()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+  if (atlas::mpi::comm().rank() != static_cast<std::size_t>(consts::kMPIRankOwner)) {
+    return;
+  }
+  int ncId;
+  if (nc_open(filePath.c_str(), NC_NOWRITE, &ncId) != NC_NOERR) {
+    utils::throwException("File \"" + filePath + "\" could not be opened...");
+  }
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    // States are written with LFRic read names
+    const std::string& varName = fieldMetadata.lfricReadName;
+    int varId;
+    int isShuffled, isDeflated, deflateLevel;
+    if (nc_inq_varid(ncId, varName.c_str(), &varId) != NC_NOERR ||
+        nc_inq_var_deflate(ncId, varId, &isShuffled, &isDeflated, &deflateLevel) != NC_NOERR) {
+      nc_close(ncId);
+      utils::throwException("Variable \"" + varName + "\" could not be inquired...");
+    }
+    if (isShuffled != 1 || isDeflated != 1 || deflateLevel != compressionLevel) {
+      nc_close(ncId);
+      utils::throwException("Variable \"" + varName + "\" is not compressed as configured...");
+    }
+#if defined(NC_HAS_QUANTIZE) && NC_HAS_QUANTIZE == 1
+    // Read from the _QuantizeGranularBitRoundNumberOfSignificantDigits attribute of the variable
+    int quantizeMode, numSignificantDigits;
+    if (nc_inq_var_quantize(ncId, varId, &quantizeMode, &numSignificantDigits) != NC_NOERR) {
+      nc_close(ncId);
+      utils::throwException("Variable \"" + varName + "\" could not be inquired...");
+    }
+    const bool isQuantised = fieldMetadata.jediName == quantisedName;
+    if ((isQuantised == true && (quantizeMode != NC_QUANTIZE_GRANULARBR ||
+                                 numSignificantDigits != quantisationPrecision)) ||
+        (isQuantised == false && quantizeMode != NC_NOQUANTIZE)) {
+      nc_close(ncId);
+      utils::throwException("Variable \"" + varName + "\" is not quantised as configured...");
+    }
+#endif
+  }
+  nc_close(ncId);
+}
+
+/// Reads back a written file, which holds no time dimension, as an increment file
+void readOutput(atlas::FieldSet& fieldSet,
+                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                const std::string& filePath) {
+  oops::Log::info() << "monio::test::readOutput()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+
+  Monio::get().readIncrements(fieldSet, fieldMetadataVec, filePath);
+}
+
+/// Writes FieldSet to file. All fields are compressed. One field is quantised and another has its
+/// own options cleared before writing, so that it takes those of all fields. Options are reset once
+/// written.
+void write(const atlas::FieldSet& fieldSet,
+           const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+           const std::string& filePath,
+           const int compressionLevel,
+           const std::string& quantisedName,
+           const int quantisationPrecision,
+           const std::string& clearedName) {
+  oops::Log::info() << "monio::test::write()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+  consts::StorageOptions storageOptions;
+  storageOptions.compression = consts::eDeflate;
+  storageOptions.compressionLevel = compressionLevel;
+  Monio::get().setStorageOptions(storageOptions);
+#if defined(NC_HAS_QUANTIZE) && NC_HAS_QUANTIZE == 1
+  consts::StorageOptions quantisedOptions = storageOptions;
+  quantisedOptions.quantisation = consts::eGranularBitRound;
+  quantisedOptions.quantisationPrecision = quantisationPrecision;
+  Monio::get().setStorageOptions(quantisedName, quantisedOptions);
+  Monio::get().setStorageOptions(clearedName, quantisedOptions);
+#endif
+  Monio::get().clearStorageOptions(clearedName);
+
+  Monio::get().writeState(fieldSet, fieldMetadataVec, filePath);
+
+  Monio::get().setStorageOptions(consts::StorageOptions());
+  Monio::get().clearStorageOptions(quantisedName);
+}
+
+/// Sets up the objects required to mimic an operational call to Monio::Read via readInput
+void initParams(atlas::FieldSet& inputFieldSet,
+                atlas::FieldSet& outputFieldSet,
+                std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                util::DateTime& dateTime,
+                std::string& inputFilePath,
+                std::string& outputFilePath,
+                int& compressionLevel,
+                std::string& quantisedName,
+                int& quantisationPrecision,
+                std::string& clearedName) {
+  oops::Log::info() << "monio::test::init()" << std::endl;
+  // FieldSet
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  atlas::functionspace::CubedSphereNodeColumns functionSpace(createFunctionSpace(paramConfig));
+
+  // fieldMetadata
+  parseFieldMetadata(paramConfig.getSubConfiguration("fieldMetadata"), fieldMetadataVec);
+  inputFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  outputFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  // Others
+  dateTime = util::DateTime(paramConfig.getString("dateTime"));
+  inputFilePath = paramConfig.getString("inputFilePath");
+  outputFilePath = paramConfig.getString("outputFilePath");
+  compressionLevel = paramConfig.getInt("compressionLevel");
+  quantisedName = paramConfig.getString("quantisedName");
+  quantisationPrecision = paramConfig.getInt("quantisationPrecision");
+  clearedName = paramConfig.getString("clearedName");
+}
+
+void main() {
+  atlas::FieldSet inputFieldSet;
+  atlas::FieldSet outputFieldSet;
+  std::vector<consts::FieldMetadata> fieldMetadataVec;
+  util::DateTime dateTime;
+  std::string inputFilePath;
+  std::string outputFilePath;
+  int compressionLevel;
+  std::string quantisedName;
+  int quantisationPrecision;
+  std::string clearedName;
+
+  initParams(inputFieldSet, outputFieldSet, fieldMetadataVec, dateTime, inputFilePath,
+             outputFilePath, compressionLevel, quantisedName, quantisationPrecision, clearedName);
+  readInput(inputFieldSet, fieldMetadataVec, dateTime, inputFilePath);
+  write(inputFieldSet, fieldMetadataVec, outputFilePath, compressionLevel, quantisedName,
+        quantisationPrecision, clearedName);
+  checkStorage(fieldMetadataVec, outputFilePath, compressionLevel, quantisedName,
+               quantisationPrecision);
+  readOutput(outputFieldSet, fieldMetadataVec, outputFilePath);
+  compareUnquantised(inputFieldSet, outputFieldSet, quantisedName);
+}
+
+class StateStorage : public oops::Test{
+ public:
+  StateStorage() {}
+  virtual ~StateStorage() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::StateStorage";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_state_storage", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
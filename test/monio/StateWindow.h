@@ -0,0 +1,177 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <string>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field.h"
+#include "atlas/functionspace/CubedSphereColumns.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/Constants.h"
+#include "monio/Monio.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/DateTime.h"
+#include "oops/util/Logger.h"
+
+#include "TestUtils.h"
+
+namespace monio {
+namespace test {
+
+/// Writes a time series of the input data to file, offset by the index of each date-time, so that
+/// the data at consecutive time steps differ
+void writeWindow(const atlas::FieldSet& inputFieldSet,
+                 std::vector<atlas::FieldSet>& fieldSets,
+                 const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                 const std::vector<util::DateTime>& dateTimes,
+                 const std::string& filePath) {
+  oops::Log::info() << "monio::test::writeWindow()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+  for (std::size_t i = 0; i < fieldSets.size(); ++i) {
+    for (auto& field : fieldSets[i]) {
+      auto inputView = atlas::array::make_view<double, 2>(inputFieldSet[field.name()]);
+      auto fieldView = atlas::array::make_view<double, 2>(field);
+      for (atlas::idx_t j = 0; j < fieldView.shape(0); ++j) {
+        for (atlas::idx_t k = 0; k < fieldView.shape(1); ++k) {
+          fieldView(j, k) = inputView(j, k) + static_cast<double>(i);
+        }
+      }
+    }
+  }
+  for (std::size_t i = 0; i < dateTimes.size(); ++i) {
+    oops::Log::info() << "dateTime> " << dateTimes[i] << std::endl;
+    Monio::get().appendState(fieldSets[i], fieldMetadataVec, filePath, dateTimes[i], i == 0);
+  }
+}
+
+/// Reads data from file at each date-time in turn, populating a FieldSet per date-time
+void readEach(std::vector<atlas::FieldSet>& fieldSets,
+              const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+              const std::vector<util::DateTime>& dateTimes,
+              const std::string& filePath) {
+  oops::Log::info() << "monio::test::readEach()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+  for (std::size_t i = 0; i < dateTimes.size(); ++i) {
+    oops::Log::info() << "dateTime> " << dateTimes[i] << std::endl;
+    Monio::get().readState(fieldSets[i], fieldMetadataVec, filePath, dateTimes[i]);
+  }
+}
+
+/// Reads data from file at all date-times with a single call
+void readWindow(std::vector<atlas::FieldSet>& fieldSets,
+                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                const std::vector<util::DateTime>& dateTimes,
+                const std::string& filePath) {
+  oops::Log::info() << "monio::test::readWindow()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+  Monio::get().readStates(fieldSets, fieldMetadataVec, filePath, dateTimes);
+}
+
+/// Sets up the objects required to mimic an operational call to Monio::Read via readInput
+void initParams(atlas::FieldSet& inputFieldSet,
+                std::vector<atlas::FieldSet>& writeFieldSets,
+                std::vector<atlas::FieldSet>& eachFieldSets,
+                std::vector<atlas::FieldSet>& windowFieldSets,
+                std::vector<atlas::FieldSet>& blockedFieldSets,
+                std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                util::DateTime& dateTime,
+                std::vector<util::DateTime>& dateTimes,
+                std::string& inputFilePath,
+                std::string& outputFilePath,
+                int& readBlockLevels) {
+  oops::Log::info() << "monio::test::init()" << std::endl;
+  // FieldSet
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  atlas::functionspace::CubedSphereNodeColumns functionSpace(createFunctionSpace(paramConfig));
+
+  // fieldMetadata
+  parseFieldMetadata(paramConfig.getSubConfiguration("fieldMetadata"), fieldMetadataVec);
+  inputFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  // Others
+  dateTime = util::DateTime(paramConfig.getString("dateTime"));
+  for (const auto& dateTimeStr : paramConfig.getStringVector("dateTimes")) {
+    dateTimes.push_back(util::DateTime(dateTimeStr));
+  }
+  for (std::size_t i = 0; i < dateTimes.size(); ++i) {
+    writeFieldSets.push_back(createFieldSet(functionSpace, fieldMetadataVec));
+    eachFieldSets.push_back(createFieldSet(functionSpace, fieldMetadataVec));
+    windowFieldSets.push_back(createFieldSet(functionSpace, fieldMetadataVec));
+    blockedFieldSets.push_back(createFieldSet(functionSpace, fieldMetadataVec));
+  }
+  inputFilePath = paramConfig.getString("inputFilePath");
+  outputFilePath = paramConfig.getString("outputFilePath");
+  readBlockLevels = paramConfig.getInt("readBlockLevels");
+}
+
+void main() {
+  atlas::FieldSet inputFieldSet;
+  std::vector<atlas::FieldSet> writeFieldSets;
+  std::vector<atlas::FieldSet> eachFieldSets;
+  std::vector<atlas::FieldSet> windowFieldSets;
+  std::vector<atlas::FieldSet> blockedFieldSets;
+  std::vector<consts::FieldMetadata> fieldMetadataVec;
+  util::DateTime dateTime;
+  std::vector<util::DateTime> dateTimes;
+  std::string inputFilePath;
+  std::string outputFilePath;
+  int readBlockLevels;
+
+  initParams(inputFieldSet, writeFieldSets, eachFieldSets, windowFieldSets, blockedFieldSets,
+             fieldMetadataVec, dateTime, dateTimes, inputFilePath, outputFilePath,
+             readBlockLevels);
+  readInput(inputFieldSet, fieldMetadataVec, dateTime, inputFilePath);
+  writeWindow(inputFieldSet, writeFieldSets, fieldMetadataVec, dateTimes, outputFilePath);
+
+  readEach(eachFieldSets, fieldMetadataVec, dateTimes, outputFilePath);
+  for (std::size_t i = 0; i < dateTimes.size(); ++i) {
+    compare(writeFieldSets[i], eachFieldSets[i]);
+  }
+  // Consecutive time steps are read with one hyperslab per field
+  readWindow(windowFieldSets, fieldMetadataVec, dateTimes, outputFilePath);
+  for (std::size_t i = 0; i < dateTimes.size(); ++i) {
+    compare(eachFieldSets[i], windowFieldSets[i]);
+  }
+
+  Monio::get().setReadBlockLevels(readBlockLevels);
+  readWindow(blockedFieldSets, fieldMetadataVec, dateTimes, outputFilePath);
+  Monio::get().setReadBlockLevels(0);
+  for (std::size_t i = 0; i < dateTimes.size(); ++i) {
+    compare(eachFieldSets[i], blockedFieldSets[i]);
+  }
+}
+
+class StateWindow : public oops::Test{
+ public:
+  StateWindow() {}
+  virtual ~StateWindow() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::StateWindow";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_state_window", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
@@ -0,0 +1,154 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#define ECKIT_TESTING_SELF_REGISTER_CASES 0
+
+#include <string>
+#include <vector>
+
+#include "atlas/field.h"
+#include "atlas/functionspace/CubedSphereColumns.h"
+#include "eckit/testing/Test.h"
+
+#include "monio/Constants.h"
+#include "monio/Monio.h"
+
+#include "oops/../test/TestEnvironment.h"
+#include "oops/runs/Test.h"
+#include "oops/util/DateTime.h"
+#include "oops/util/Logger.h"
+
+#include "TestUtils.h"
+
+namespace monio {
+namespace test {
+
+/// Reads back a written file, which holds no time dimension, as an increment file
+void readOutput(atlas::FieldSet& fieldSet,
+                const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                const std::string& filePath) {
+  oops::Log::info() << "monio::test::readOutput()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+
+  Monio::get().readIncrements(fieldSet, fieldMetadataVec, filePath);
+}
+
+/// Writes FieldSet to file.
+void write(const atlas::FieldSet& fieldSet,
+           const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+           const std::string& filePath) {
+  oops::Log::info() << "monio::test::write()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+
+  Monio::get().writeState(fieldSet, fieldMetadataVec, filePath);
+}
+
+/// Sets up the objects required to mimic an operational call to Monio::Read via readInput
+void initParams(atlas::FieldSet& inputFieldSet,
+                atlas::FieldSet& syncFieldSet,
+                atlas::FieldSet& asyncFieldSet,
+                atlas::FieldSet& blockedFieldSet,
+                atlas::FieldSet& parallelFieldSet,
+                std::vector<consts::FieldMetadata>& fieldMetadataVec,
+                util::DateTime& dateTime,
+                std::string& inputFilePath,
+                std::string& syncFilePath,
+                std::string& asyncFilePath,
+                std::string& blockedFilePath,
+                std::string& parallelFilePath,
+                std::size_t& writeBlockLevels) {
+  oops::Log::info() << "monio::test::init()" << std::endl;
+  // FieldSet
+  const eckit::LocalConfiguration paramConfig(::test::TestEnvironment::config(), "parameters");
+  atlas::functionspace::CubedSphereNodeColumns functionSpace(createFunctionSpace(paramConfig));
+
+  // fieldMetadata
+  parseFieldMetadata(paramConfig.getSubConfiguration("fieldMetadata"), fieldMetadataVec);
+  inputFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  syncFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  asyncFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  blockedFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  parallelFieldSet = createFieldSet(functionSpace, fieldMetadataVec);
+  // Others
+  dateTime = util::DateTime(paramConfig.getString("dateTime"));
+  inputFilePath = paramConfig.getString("inputFilePath");
+  syncFilePath = paramConfig.getString("syncFilePath");
+  asyncFilePath = paramConfig.getString("asyncFilePath");
+  blockedFilePath = paramConfig.getString("blockedFilePath");
+  parallelFilePath = paramConfig.getString("parallelFilePath");
+  writeBlockLevels = paramConfig.getInt("writeBlockLevels");
+}
+
+void main() {
+  atlas::FieldSet inputFieldSet;
+  atlas::FieldSet syncFieldSet;
+  atlas::FieldSet asyncFieldSet;
+  atlas::FieldSet blockedFieldSet;
+  atlas::FieldSet parallelFieldSet;
+  std::vector<consts::FieldMetadata> fieldMetadataVec;
+  util::DateTime dateTime;
+  std::string inputFilePath;
+  std::string syncFilePath;
+  std::string asyncFilePath;
+  std::string blockedFilePath;
+  std::string parallelFilePath;
+  std::size_t writeBlockLevels;
+
+  initParams(inputFieldSet, syncFieldSet, asyncFieldSet, blockedFieldSet, parallelFieldSet,
+             fieldMetadataVec, dateTime, inputFilePath, syncFilePath, asyncFilePath,
+             blockedFilePath, parallelFilePath, writeBlockLevels);
+  readInput(inputFieldSet, fieldMetadataVec, dateTime, inputFilePath);
+
+  write(inputFieldSet, fieldMetadataVec, syncFilePath);
+  readOutput(syncFieldSet, fieldMetadataVec, syncFilePath);
+  compare(inputFieldSet, syncFieldSet);
+
+  Monio::get().setAsyncWrite(true);
+  write(inputFieldSet, fieldMetadataVec, asyncFilePath);
+  Monio::get().waitForWrites();
+  Monio::get().setAsyncWrite(false);
+  readOutput(asyncFieldSet, fieldMetadataVec, asyncFilePath);
+  compare(syncFieldSet, asyncFieldSet);
+
+  // Blocks smaller than the fields, including those whose surface level is copied on writing
+  Monio::get().setWriteBlockLevels(writeBlockLevels);
+  write(inputFieldSet, fieldMetadataVec, blockedFilePath);
+  Monio::get().setWriteBlockLevels(0);
+  readOutput(blockedFieldSet, fieldMetadataVec, blockedFilePath);
+  compare(syncFieldSet, blockedFieldSet);
+
+  Monio::get().setParallelWrite(true);
+  write(inputFieldSet, fieldMetadataVec, parallelFilePath);
+  Monio::get().setParallelWrite(false);
+  readOutput(parallelFieldSet, fieldMetadataVec, parallelFilePath);
+  compare(syncFieldSet, parallelFieldSet);
+}
+
+class StateWrite : public oops::Test{
+ public:
+  StateWrite() {}
+  virtual ~StateWrite() {}
+
+ private:
+  std::string testid() const override {
+    return "monio::test::StateWrite";
+  }
+
+  void register_tests() const override {
+    std::vector<eckit::testing::Test>& ts = eckit::testing::specification();
+
+    std::function<void(std::string&, int&, int)> mainFunction =
+        [&](std::string&, int&, int) { main(); };
+    ts.push_back(eckit::testing::Test("monio/test_state_write", mainFunction));
+  }
+  void clear() const override {}
+};
+}  // namespace test
+}  // namespace monio
@@ -0,0 +1,127 @@
+/******************************************************************************
+* MONIO - Met Office NetCDF Input Output                                      *
+*                                                                             *
+* (C) Crown Copyright 2023, Met Office. All rights reserved.                  *
+*                                                                             *
+* This software is licensed under the terms of the 3-Clause BSD License       *
+* which can be obtained from https://opensource.org/license/bsd-3-clause/.    *
+******************************************************************************/
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "atlas/field.h"
+#include "atlas/functionspace/CubedSphereColumns.h"
+#include "atlas/grid/CubedSphereGrid.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/meshgenerator/MeshGenerator.h"
+#include "eckit/config/LocalConfiguration.h"
+
+#include "monio/Constants.h"
+#include "monio/Monio.h"
+#include "monio/Utils.h"
+#include "monio/UtilsAtlas.h"
+
+#include "oops/util/DateTime.h"
+#include "oops/util/Logger.h"
+
+namespace monio {
+namespace test {
+
+atlas::Mesh createMesh(const atlas::CubedSphereGrid& grid,
+                       const std::string& partitionerType,
+                       const std::string& meshType) {
+  oops::Log::debug() << "monio::test::createMesh()" << std::endl;
+  const auto meshConfig = atlas::util::Config("partitioner", partitionerType) |
+                          atlas::util::Config("halo", 0);
+  const auto meshGen = atlas::MeshGenerator(meshType, meshConfig);
+  return meshGen.generate(grid);
+}
+
+atlas::functionspace::CubedSphereNodeColumns createFunctionSpace(const atlas::Mesh& csMesh) {
+  oops::Log::debug() << "monio::test::createFunctionSpace()" << std::endl;
+  const auto functionSpace = atlas::functionspace::CubedSphereNodeColumns(csMesh);
+  return functionSpace;
+}
+
+/// Creates the function space of the grid, partitioner and mesh given by test parameters
+atlas::functionspace::CubedSphereNodeColumns createFunctionSpace(
+                                              const eckit::LocalConfiguration& paramConfig) {
+  oops::Log::debug() << "monio::test::createFunctionSpace()" << std::endl;
+  const std::string gridName(paramConfig.getString("gridName"));
+  const std::string partitionerType(paramConfig.getString("partitionerType"));
+  const std::string meshType(paramConfig.getString("meshType"));
+
+  atlas::CubedSphereGrid grid(gridName);
+  atlas::Mesh mesh(createMesh(grid, partitionerType, meshType));
+  return createFunctionSpace(mesh);
+}
+
+atlas::FieldSet createFieldSet(const atlas::functionspace::CubedSphereNodeColumns& functionSpace,
+                               std::vector<consts::FieldMetadata>& fieldMetadataVec) {
+  oops::Log::debug() << "monio::test::createFieldSet()" << std::endl;
+  atlas::FieldSet fieldSet;
+  for (const auto& fieldMetadata : fieldMetadataVec) {
+    // To mimic JEDI's behaviour fields full or half fields are initialised with 70 levels
+    int numLevels = fieldMetadata.numberOfLevels == consts::kVerticalFullSize ?
+                    consts::kVerticalHalfSize : fieldMetadata.numberOfLevels;
+    // No error checking on metadata. This is handled by calls to Monio
+    atlas::util::Config atlasOptions = atlas::option::name(fieldMetadata.jediName) |
+                                       atlas::option::levels(numLevels);
+    fieldSet.add(functionSpace.createField<double>(atlasOptions));
+  }
+  return fieldSet;
+}
+
+void compare(atlas::FieldSet& firstFieldSet, atlas::FieldSet& secondFieldSet) {
+  oops::Log::info() << "monio::test::compare()" << std::endl;
+
+  if (utilsatlas::compareFieldSets(firstFieldSet, secondFieldSet) == false) {
+    utils::throwException("FieldSets do not match...");
+  }
+}
+
+/// Reads data from file and populates the FieldSet
+void readInput(atlas::FieldSet& fieldSet,
+               const std::vector<consts::FieldMetadata>& fieldMetadataVec,
+               const util::DateTime& dateTime,
+               const std::string& filePath) {
+  oops::Log::info() << "monio::test::readInput()" << std::endl;
+  oops::Log::info() << "filePath> " << filePath << std::endl;
+  oops::Log::info() << "dateTime> " << dateTime << std::endl;
+
+  Monio::get().readState(fieldSet, fieldMetadataVec, filePath, dateTime);
+}
+
+/// Parses field metadata from test configuration, one comma-separated entry per field. The output
+/// type and first level read are optional.
+void parseFieldMetadata(const eckit::LocalConfiguration& fieldMetadataConfig,
+                        std::vector<consts::FieldMetadata>& fieldMetadataVec) {
+  for (const auto& key : fieldMetadataConfig.keys()) {
+    std::vector<std::string> stringVec = utils::strToWords(fieldMetadataConfig.getString(key),
+                                                           ',');
+
+    consts::FieldMetadata fieldMetadata;
+    fieldMetadata.lfricReadName = utils::strNoWhiteSpace(stringVec[consts::eLfricReadName]);
+    fieldMetadata.lfricWriteName = utils::strNoWhiteSpace(stringVec[consts::eLfricWriteName]);
+    fieldMetadata.jediName = utils::strNoWhiteSpace(stringVec[consts::eJediName]);
+    fieldMetadata.lfricVertConfig = utils::strNoWhiteSpace(stringVec[consts::eLfricVertConfig]);
+    fieldMetadata.jediVertConfig = utils::strNoWhiteSpace(stringVec[consts::eJediVertConfig]);
+    fieldMetadata.units = utils::strNoWhiteSpace(stringVec[consts::eUnits]);
+    fieldMetadata.numberOfLevels =
+                    std::stoi(utils::strNoWhiteSpace(stringVec[consts::eNumberOfLevels]));
+    fieldMetadata.noFirstLevel = utils::strToBool(stringVec[consts::eNoFirstLevel]);
+    if (stringVec.size() > consts::eOutputType) {
+      fieldMetadata.outputType = utils::strToDataType(stringVec[consts::eOutputType]);
+    }
+    if (stringVec.size() > consts::eReadLevelStart) {
+      fieldMetadata.readLevelStart =
+                      std::stoi(utils::strNoWhiteSpace(stringVec[consts::eReadLevelStart]));
+    }
+
+    fieldMetadataVec.push_back(fieldMetadata);
+  }
+}
+}  // namespace test
+}  // namespace monio